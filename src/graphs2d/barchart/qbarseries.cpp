@@ -1248,7 +1248,7 @@ qreal QBarSeriesPrivate::minX()
     for (int i = 0; i < m_barSets.size(); i++) {
         qsizetype categoryCount = m_barSets.at(i)->count();
         for (qsizetype j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_func()->m_values.at(j).x();
+            qreal temp = m_barSets.at(i)->d_func()->pos(j);
             if (temp < min)
                 min = temp;
         }
@@ -1266,7 +1266,7 @@ qreal QBarSeriesPrivate::maxX()
     for (int i = 0; i < m_barSets.size(); i++) {
         qsizetype categoryCount = m_barSets.at(i)->count();
         for (qsizetype j = 0; j < categoryCount; j++) {
-            qreal temp = m_barSets.at(i)->d_func()->m_values.at(j).x();
+            qreal temp = m_barSets.at(i)->d_func()->pos(j);
             if (temp > max)
                 max = temp;
         }
@@ -5,6 +5,9 @@
 #include <private/qbarset_p.h>
 #include <private/charthelpers_p.h>
 
+#include <algorithm>
+#include <iterator>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -331,9 +334,8 @@ QString QBarSet::label() const
 void QBarSet::append(qreal value)
 {
     Q_D(QBarSet);
-    // Convert to QPointF
     qsizetype index = d->m_values.size();
-    d->append(QPointF(d->m_values.size(), value));
+    d->append(value);
     emit valuesAdded(index, 1);
     emit countChanged();
     emit update();
@@ -441,6 +443,75 @@ void QBarSet::replace(qsizetype index, qreal value)
     }
 }
 
+/*!
+    \qmlmethod BarSet::replace(list<real> values)
+    \since 6.10
+    Replaces all values of the bar set with \a values.
+    \note This is much faster than replacing values one by one, or first clearing
+    the set and then appending the new values. Invalid values, such as NaN, are
+    skipped like in append(). Selected bars beyond the new count are deselected.
+    Emits \l valuesChanged when the values have been replaced.
+*/
+/*!
+    \since 6.10
+    Replaces all values of the bar set with \a values.
+    \note This is much faster than replacing values one by one, or first clearing
+    the set and then appending the new values. Invalid values, such as NaN, are
+    skipped like in append(). Selected bars beyond the new count are deselected.
+    Emits \l valuesChanged when the values have been replaced.
+
+    \sa realValues()
+*/
+void QBarSet::replace(const QList<qreal> &values)
+{
+    Q_D(QBarSet);
+    const qsizetype oldCount = d->m_values.size();
+    const auto isValid = [](qreal value) { return isValidValue(value); };
+    const auto firstInvalid = std::find_if_not(values.cbegin(), values.cend(), isValid);
+    if (firstInvalid == values.cend()) {
+        d->m_values = values;
+    } else {
+        d->m_values = QList<qreal>(values.cbegin(), firstInvalid);
+        std::copy_if(firstInvalid + 1, values.cend(), std::back_inserter(d->m_values), isValid);
+    }
+    const bool hasDifferentSize = d->m_values.size() != oldCount;
+
+    bool callSignal = false;
+    if (hasDifferentSize && !d->m_selectedBars.isEmpty()) {
+        for (auto it = d->m_selectedBars.begin(); it != d->m_selectedBars.end();) {
+            if (*it >= d->m_values.size()) {
+                it = d->m_selectedBars.erase(it);
+                callSignal = true;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    d->setLabelsDirty(true);
+    emit valuesChanged();
+    if (hasDifferentSize)
+        emit countChanged();
+    if (callSignal)
+        emit selectedBarsChanged(selectedBars());
+    emit update();
+}
+
+/*!
+    \since 6.10
+    Returns the values of the bar set without converting them.
+
+    Unlike \l values, this returns a reference to the internal storage, so it
+    is only valid until the bar set is modified or destroyed.
+
+    \sa replace()
+*/
+const QList<qreal> &QBarSet::realValues() const
+{
+    Q_D(const QBarSet);
+    return d->m_values;
+}
+
 /*!
     \qmlmethod real BarSet::at(int index)
     Returns the value specified by \a index from the bar set.
@@ -455,7 +526,7 @@ qreal QBarSet::at(qsizetype index) const
     Q_D(const QBarSet);
     if (index < 0 || index >= d->m_values.size())
         return 0;
-    return d->m_values.at(index).y();
+    return d->m_values.at(index);
 }
 
 /*!
@@ -482,8 +553,8 @@ qreal QBarSet::sum() const
 {
     Q_D(const QBarSet);
     qreal total(0);
-    for (int i = 0; i < d->m_values.size(); i++)
-        total += d->m_values.at(i).y();
+    for (const qreal value : d->m_values)
+        total += value;
     return total;
 }
 
@@ -636,9 +707,11 @@ void QBarSet::setBorderWidth(qreal width)
 
 QVariantList QBarSet::values() const
 {
+    Q_D(const QBarSet);
     QVariantList values;
-    for (qsizetype i(0); i < count(); i++)
-        values.append(QVariant(QBarSet::at(i)));
+    values.reserve(d->m_values.size());
+    for (const qreal value : d->m_values)
+        values.append(QVariant(value));
     return values;
 }
 
@@ -903,7 +976,7 @@ QBarSetPrivate::QBarSetPrivate(const QString &label)
 
 QBarSetPrivate::~QBarSetPrivate() {}
 
-void QBarSetPrivate::append(QPointF value)
+void QBarSetPrivate::append(qreal value)
 {
     if (isValidValue(value)) {
         Q_Q(QBarSet);
@@ -912,39 +985,19 @@ void QBarSetPrivate::append(QPointF value)
     }
 }
 
-void QBarSetPrivate::append(const QList<QPointF> &values)
-{
-    qsizetype originalIndex = m_values.size();
-    for (const auto &value : values) {
-        if (isValidValue(value))
-            m_values.append(value);
-    }
-    Q_Q(QBarSet);
-    emit q->valueAdded(originalIndex, values.size());
-}
-
 void QBarSetPrivate::append(const QList<qreal> &values)
 {
     qsizetype originalIndex = m_values.size();
-    qsizetype index = originalIndex;
+    m_values.reserve(originalIndex + values.size());
     for (const auto value : values) {
-        if (isValidValue(value)) {
-            m_values.append(QPointF(index, value));
-            index++;
-        }
+        if (isValidValue(value))
+            m_values.append(value);
     }
     Q_Q(QBarSet);
     emit q->valueAdded(originalIndex, values.size());
 }
 
 void QBarSetPrivate::insert(qsizetype index, qreal value)
-{
-    m_values.insert(index, QPointF(index, value));
-    Q_Q(QBarSet);
-    emit q->valueAdded(index, 1);
-}
-
-void QBarSetPrivate::insert(qsizetype index, QPointF value)
 {
     m_values.insert(index, value);
     Q_Q(QBarSet);
@@ -960,11 +1013,8 @@ qsizetype QBarSetPrivate::remove(qsizetype index, qsizetype count)
     else if ((index + count) > m_values.size())
         removeCount = m_values.size() - index; // Trying to remove more items than list has. Limit amount to be removed.
 
-    int c = 0;
-    while (c < removeCount) {
-        m_values.removeAt(index);
-        c++;
-    }
+    if (removeCount > 0)
+        m_values.remove(index, removeCount);
 
     bool callSignal = false;
     if (!m_selectedBars.empty()) {
@@ -996,21 +1046,21 @@ void QBarSetPrivate::replace(qsizetype index, qreal value)
     if (index < 0 || index >= m_values.size())
         return;
 
-    m_values.replace(index, QPointF(index, value));
+    m_values.replace(index, value);
 }
 
 qreal QBarSetPrivate::pos(qsizetype index) const
 {
     if (index < 0 || index >= m_values.size())
         return 0;
-    return m_values.at(index).x();
+    return index;
 }
 
 qreal QBarSetPrivate::value(qsizetype index) const
 {
     if (index < 0 || index >= m_values.size())
         return 0;
-    return m_values.at(index).y();
+    return m_values.at(index);
 }
 
 void QBarSetPrivate::setBarSelected(qsizetype index, bool selected, bool &callSignal)
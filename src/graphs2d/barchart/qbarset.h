@@ -46,6 +46,7 @@ public:
     Q_INVOKABLE void insert(qsizetype index, qreal value);
     Q_INVOKABLE void remove(qsizetype index, qsizetype count = 1);
     Q_INVOKABLE void replace(qsizetype index, qreal value);
+    Q_REVISION(6, 10) Q_INVOKABLE void replace(const QList<qreal> &values);
     Q_INVOKABLE qreal at(qsizetype index) const;
     Q_INVOKABLE qsizetype count() const;
     Q_INVOKABLE qreal sum() const;
@@ -68,6 +69,7 @@ public:
 
     QVariantList values() const;
     void setValues(const QVariantList &values);
+    const QList<qreal> &realValues() const;
     qreal borderWidth() const;
     void setBorderWidth(qreal borderWidth);
 
@@ -30,12 +30,10 @@ public:
     QBarSetPrivate(const QString &label);
     ~QBarSetPrivate() override;
 
-    void append(QPointF value);
-    void append(const QList<QPointF> &values);
+    void append(qreal value);
     void append(const QList<qreal> &values);
 
     void insert(qsizetype index, qreal value);
-    void insert(qsizetype index, QPointF value);
     qsizetype remove(qsizetype index, qsizetype count);
 
     void replace(qsizetype index, qreal value);
@@ -53,7 +51,8 @@ public:
 
 public:
     QString m_label;
-    QList<QPointF> m_values;
+    // Values are stored in category order, so the position of each value is its index
+    QList<qreal> m_values;
     QSet<qsizetype> m_selectedBars;
     // By default colors are transparent, meaning that use the ones from theme
     QColor m_color = QColor(Qt::transparent);
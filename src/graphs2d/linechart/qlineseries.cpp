@@ -64,6 +64,26 @@ QT_BEGIN_NAMESPACE
     \endcode
 */
 
+/*!
+    \property QLineSeries::decimationEnabled
+    \brief Controls whether the line is decimated before drawing.
+    \since 6.10
+
+    When enabled and the series has more points than can be distinguished on
+    screen, only the first, last, minimum and maximum point of each pixel column
+    are drawn. This preserves the visual envelope of the line while drawing
+    only a number of segments proportional to the plot width.
+    By default, decimationEnabled is set to \c false.
+*/
+/*!
+    \qmlproperty bool LineSeries::decimationEnabled
+    \since 6.10
+    Controls whether the line is decimated before drawing. When enabled and
+    the series has more points than can be distinguished on screen, only the
+    first, last, minimum and maximum point of each pixel column are drawn.
+    By default, decimationEnabled is set to \c false.
+*/
+
 /*!
     \qmlsignal LineSeries::widthChanged()
     This signal is emitted when the line series width changes.
@@ -74,6 +94,12 @@ QT_BEGIN_NAMESPACE
     This signal is emitted when the line series cap style changes.
 */
 
+/*!
+    \qmlsignal LineSeries::decimationEnabledChanged()
+    \since 6.10
+    This signal is emitted when the line series decimation changes.
+*/
+
 QLineSeries::QLineSeries(QObject *parent)
     : QXYSeries(*(new QLineSeriesPrivate()), parent)
 {}
@@ -146,4 +172,20 @@ void QLineSeries::setCapStyle(Qt::PenCapStyle newCapStyle)
     emit update();
 }
 
+bool QLineSeries::decimationEnabled() const
+{
+    Q_D(const QLineSeries);
+    return d->m_decimationEnabled;
+}
+
+void QLineSeries::setDecimationEnabled(bool enabled)
+{
+    Q_D(QLineSeries);
+    if (d->m_decimationEnabled == enabled)
+        return;
+    d->m_decimationEnabled = enabled;
+    emit decimationEnabledChanged();
+    emit update();
+}
+
 QT_END_NAMESPACE
@@ -16,6 +16,8 @@ class Q_GRAPHS_EXPORT QLineSeries : public QXYSeries
     Q_OBJECT
     Q_PROPERTY(qreal width READ width WRITE setWidth NOTIFY widthChanged FINAL)
     Q_PROPERTY(Qt::PenCapStyle capStyle READ capStyle WRITE setCapStyle NOTIFY capStyleChanged FINAL)
+    Q_PROPERTY(bool decimationEnabled READ decimationEnabled WRITE setDecimationEnabled NOTIFY
+                   decimationEnabledChanged REVISION(6, 10) FINAL)
 
     QML_NAMED_ELEMENT(LineSeries)
 public:
@@ -30,9 +32,13 @@ public:
     Qt::PenCapStyle capStyle() const;
     void setCapStyle(Qt::PenCapStyle newCapStyle);
 
+    bool decimationEnabled() const;
+    void setDecimationEnabled(bool enabled);
+
 Q_SIGNALS:
     void widthChanged();
     void capStyleChanged();
+    Q_REVISION(6, 10) void decimationEnabledChanged();
 
 protected:
     QLineSeries(QLineSeriesPrivate &dd, QObject *parent = nullptr);
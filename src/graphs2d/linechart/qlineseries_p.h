@@ -27,6 +27,7 @@ public:
 protected:
     qreal m_width = 2.0;
     Qt::PenCapStyle m_capStyle = Qt::PenCapStyle::SquareCap;
+    bool m_decimationEnabled = false;
 
 private:
     Q_DECLARE_PUBLIC(QLineSeries)
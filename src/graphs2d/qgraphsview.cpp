@@ -140,8 +140,9 @@ void QGraphsView::insertSeries(qsizetype index, QObject *object)
         } else {
             m_seriesList.insert(index, series);
 
-            QObject::connect(series, &QAbstractSeries::update,
-                             this, &QGraphsView::polishAndUpdate);
+            QObject::connect(series, &QAbstractSeries::update, this, [this, series]() {
+                polishAndUpdateSeries(series);
+            });
             QObject::connect(series, &QAbstractSeries::hoverEnter,
                              this, &QGraphsView::handleHoverEnter);
             QObject::connect(series, &QAbstractSeries::hoverExit,
@@ -170,6 +171,7 @@ void QGraphsView::removeSeries(QObject *object)
     if (auto series = reinterpret_cast<QAbstractSeries *>(object)) {
         series->setGraph(nullptr);
         m_seriesList.removeAll(series);
+        m_dirtySeries.remove(series);
         auto &cleanupSeriesList = m_cleanupSeriesList[getSeriesRendererIndex(series)];
 
 #ifdef USE_PIEGRAPH
@@ -527,6 +529,9 @@ void QGraphsView::handleHover(const QString &seriesName, QPointF position, QPoin
 
 void QGraphsView::updateComponentSizes()
 {
+    // Renderer sizes change, so everything needs to be laid out again
+    m_allDirty = true;
+
     updateAxisAreas();
     updatePlotArea();
 
@@ -747,8 +752,10 @@ QSGNode *QGraphsView::updatePaintNode(QSGNode *oldNode, QQuickItem::UpdatePaintN
 
 void QGraphsView::updatePolish()
 {
-    if (m_axisRenderer) {
+    const bool allDirty = m_allDirty;
+    if (m_axisRenderer && allDirty) {
         m_axisRenderer->handlePolish();
+        m_axisPolishCount++;
         // Initialize shaders after system's event queue
         QTimer::singleShot(0, m_axisRenderer, &AxisRenderer::initialize);
     }
@@ -769,8 +776,12 @@ void QGraphsView::updatePolish()
         m_backgroundRectangle = nullptr;
     }
 
-    // Polish for all series
+    // Polish for changed series
     for (auto series : std::as_const(m_seriesList)) {
+        if (!allDirty && !m_dirtySeries.contains(series))
+            continue;
+        m_seriesPolishCount++;
+
 #ifdef USE_BARGRAPH
         if (m_barsRenderer) {
             if (auto barSeries = qobject_cast<QBarSeries*>(series))
@@ -836,10 +847,22 @@ void QGraphsView::updatePolish()
         m_pieRenderer->afterPolish(cleanupSeriesList);
     }
 #endif
+
+    m_dirtySeries.clear();
+    m_allDirty = false;
 }
 
 void QGraphsView::polishAndUpdate()
 {
+    m_allDirty = true;
+    polish();
+    update();
+}
+
+void QGraphsView::polishAndUpdateSeries(QAbstractSeries *series)
+{
+    if (!m_allDirty)
+        m_dirtySeries.insert(series);
     polish();
     update();
 }
@@ -181,6 +181,10 @@ public:
     qreal zoomSensitivity() const;
     void setZoomSensitivity(qreal newZoomSensitivity);
 
+    // Number of series and axis polishes done, for verifying incremental updates
+    qsizetype seriesPolishCount() const { return m_seriesPolishCount; }
+    qsizetype axisPolishCount() const { return m_axisPolishCount; }
+
 protected:
     void handleHoverEnter(const QString &seriesName, QPointF position, QPointF value);
     void handleHoverExit(const QString &seriesName, QPointF position);
@@ -236,6 +240,7 @@ private:
     friend class QAbstractAxis;
 
     void polishAndUpdate();
+    void polishAndUpdateSeries(QAbstractSeries *series);
     int getSeriesRendererIndex(QAbstractSeries *series);
     void onPinchScaleChanged(qreal delta);
     void onPinchGrabChanged(QPointingDevice::GrabTransition transition, QEventPoint point);
@@ -254,6 +259,11 @@ private:
     AreaRenderer *m_areaRenderer = nullptr;
     QList<QObject *> m_seriesList;
     QHash<int, QList<QAbstractSeries *>> m_cleanupSeriesList;
+    // Series which need to be polished, everything is polished when m_allDirty is set
+    QSet<QObject *> m_dirtySeries;
+    bool m_allDirty = true;
+    qsizetype m_seriesPolishCount = 0;
+    qsizetype m_axisPolishCount = 0;
     QQuickRectangle *m_backgroundRectangle = nullptr;
 
     QAbstractAxis *m_axisX = nullptr;
@@ -12,6 +12,8 @@
 #include <private/qxyseries_p.h>
 #include <QtQuick/private/qquicktaphandler_p.h>
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
 AreaRenderer::AreaRenderer(QGraphsView *graph)
@@ -86,6 +88,8 @@ void AreaRenderer::handlePolish(QAreaSeries *series)
         auto painterPath = group->painterPath;
         painterPath.clear();
         group->shapePath->setPath(painterPath);
+        group->firstPoints.clear();
+        group->secondPoints.clear();
         return;
     }
 
@@ -221,6 +225,7 @@ void AreaRenderer::handlePolish(QAreaSeries *series)
     }
 
     group->shapePath->setPath(painterPath);
+    updateHitTestPoints(group);
 
     QList<QLegendData> legendDataList = {{color, borderColor, series->name()}};
     series->d_func()->setLegendData(legendDataList);
@@ -275,63 +280,102 @@ bool pointInTriangle(QPoint pt, QPoint v1, QPoint v2, QPoint v3)
     return !(hasNeg && hasPos);
 }
 
-bool AreaRenderer::pointInArea(QPoint pt, QAreaSeries *series) const
+static int xOrderOf(const QList<QPointF> &points)
 {
-    QList<QPointF> upperPoints = series->upperSeries()->points();
-    QList<QPointF> lowerPoints;
-
-    if (series->lowerSeries())
-        lowerPoints = series->lowerSeries()->points();
-
-    QList<QPointF> *firstPoints = &upperPoints;
-    if (lowerPoints.size() > upperPoints.size())
-        firstPoints = &lowerPoints;
-
-    for (int i = 0; i < firstPoints->size() - 1; ++i) {
-        qreal x1, y1, x2, y2, x3, y3, x4, y4;
-        calculateRenderCoordinates((*firstPoints)[i].x(), (*firstPoints)[i].y(), &x1, &y1);
-        calculateRenderCoordinates((*firstPoints)[i + 1].x(), (*firstPoints)[i + 1].y(), &x2, &y2);
-
-        bool needSecondTriangleTest = true;
-        if (series->lowerSeries()) {
-            QList<QPointF> *secondPoints = &lowerPoints;
-            if (lowerPoints.size() > upperPoints.size())
-                secondPoints = &upperPoints;
-
-            qsizetype firstIndex = i;
-            qsizetype secondIndex = i + 1;
-
-            if (firstIndex >= secondPoints->size())
-                firstIndex = secondPoints->size() - 1;
-            if (secondIndex >= secondPoints->size())
-                needSecondTriangleTest = false;
-
-            calculateRenderCoordinates((*secondPoints)[firstIndex].x(),
-                                       (*secondPoints)[firstIndex].y(),
-                                       &x3,
-                                       &y3);
-
-            if (needSecondTriangleTest) {
-                calculateRenderCoordinates((*secondPoints)[secondIndex].x(),
-                                           (*secondPoints)[secondIndex].y(),
-                                           &x4,
-                                           &y4);
-            } else {
-                x4 = 0.0;
-                y4 = 0.0;
-            }
-        } else {
-            calculateRenderCoordinates(upperPoints[i].x(), 0, &x3, &y3);
-            calculateRenderCoordinates(upperPoints[i + 1].x(), 0, &x4, &y4);
+    bool ascending = true;
+    bool descending = true;
+    for (qsizetype i = 1; i < points.size() && (ascending || descending); ++i) {
+        ascending &= points[i - 1].x() <= points[i].x();
+        descending &= points[i - 1].x() >= points[i].x();
+    }
+    return ascending ? 1 : (descending ? -1 : 0);
+}
+
+void AreaRenderer::updateHitTestPoints(PointGroup *group)
+{
+    const auto &upperPoints = group->series->upperSeries()->points();
+    QXYSeries *lower = group->series->lowerSeries();
+    auto &firstPoints = group->firstPoints;
+    auto &secondPoints = group->secondPoints;
+    firstPoints.clear();
+    secondPoints.clear();
+
+    auto append = [this](QList<QPointF> &renderPoints, qreal x, qreal y) {
+        qreal renderX, renderY;
+        calculateRenderCoordinates(x, y, &renderX, &renderY);
+        renderPoints.append(QPointF(renderX, renderY));
+    };
+
+    if (lower) {
+        const auto &lowerPoints = lower->points();
+        const bool upperFirst = lowerPoints.size() <= upperPoints.size();
+        for (const QPointF &point : upperFirst ? upperPoints : lowerPoints)
+            append(firstPoints, point.x(), point.y());
+        for (const QPointF &point : upperFirst ? lowerPoints : upperPoints)
+            append(secondPoints, point.x(), point.y());
+    } else {
+        for (const QPointF &point : upperPoints) {
+            append(firstPoints, point.x(), point.y());
+            append(secondPoints, point.x(), 0);
         }
+    }
+
+    const int firstOrder = xOrderOf(firstPoints);
+    group->xOrder = firstOrder == xOrderOf(secondPoints) ? firstOrder : 0;
+    group->segmentMinX.clear();
+    group->segmentMaxX.clear();
+    if (group->xOrder == 0)
+        return;
+
+    // Both extents grow monotonically along the boundaries, in the direction of xOrder
+    const qsizetype segmentCount = firstPoints.size() - 1;
+    group->segmentMinX.reserve(segmentCount);
+    group->segmentMaxX.reserve(segmentCount);
+    for (qsizetype i = 0; i < segmentCount; ++i) {
+        const qsizetype secondStart = qMin(i, secondPoints.size() - 1);
+        const qsizetype secondEnd = qMin(i + 1, secondPoints.size() - 1);
+        const qreal x1 = firstPoints[i].x() * group->xOrder;
+        const qreal x2 = firstPoints[i + 1].x() * group->xOrder;
+        const qreal x3 = secondPoints[secondStart].x() * group->xOrder;
+        const qreal x4 = secondPoints[secondEnd].x() * group->xOrder;
+        group->segmentMinX.append(qMin(qMin(x1, x2), qMin(x3, x4)));
+        group->segmentMaxX.append(qMax(qMax(x1, x2), qMax(x3, x4)));
+    }
+}
+
+bool AreaRenderer::pointInArea(QPoint pt, const PointGroup *group) const
+{
+    const auto &firstPoints = group->firstPoints;
+    const auto &secondPoints = group->secondPoints;
+    if (firstPoints.size() < 2 || secondPoints.isEmpty())
+        return false;
+
+    qsizetype begin = 0;
+    qsizetype end = firstPoints.size() - 1;
+    if (group->xOrder != 0) {
+        // The triangles are tested in whole pixels, so allow for a pixel of rounding
+        const qreal x = pt.x() * group->xOrder;
+        const auto &minX = group->segmentMinX;
+        const auto &maxX = group->segmentMaxX;
+        begin = std::partition_point(maxX.begin(), maxX.end(),
+                                     [x](qreal value) { return value < x - 1; })
+                - maxX.begin();
+        end = std::partition_point(minX.begin(), minX.end(),
+                                   [x](qreal value) { return value <= x + 1; })
+              - minX.begin();
+    }
 
-        QPoint point1(x1, y1);
-        QPoint point2(x2, y2);
-        QPoint point3(x3, y3);
-        QPoint point4(x4, y4);
+    auto toPoint = [](const QPointF &point) { return QPoint(point.x(), point.y()); };
+    for (qsizetype i = begin; i < end; ++i) {
+        const qsizetype secondIndex = i + 1;
+        const bool needSecondTriangleTest = secondIndex < secondPoints.size();
+        const QPoint point1 = toPoint(firstPoints[i]);
+        const QPoint point2 = toPoint(firstPoints[i + 1]);
+        const QPoint point3 = toPoint(secondPoints[qMin(i, secondPoints.size() - 1)]);
 
         if (pointInTriangle(pt, point1, point2, point3)
-            || (needSecondTriangleTest && pointInTriangle(pt, point2, point3, point4))) {
+            || (needSecondTriangleTest
+                && pointInTriangle(pt, point2, point3, toPoint(secondPoints[secondIndex])))) {
             return true;
         }
     }
@@ -357,7 +401,7 @@ bool AreaRenderer::handleHoverMove(QHoverEvent *event)
         const QString &name = group->series->name();
 
         bool hovering = false;
-        if (pointInArea(position.toPoint(), group->series)) {
+        if (pointInArea(position.toPoint(), group)) {
             qreal x, y;
             calculateAxisCoordinates(position.x(), position.y(), &x, &y);
 
@@ -396,7 +440,7 @@ void AreaRenderer::onSingleTapped(QEventPoint eventPoint, Qt::MouseButton button
         if (group->series->lowerSeries() && group->series->lowerSeries()->count() < 2)
             continue;
 
-        if (pointInArea(eventPoint.position().toPoint(), group->series)) {
+        if (pointInArea(eventPoint.position().toPoint(), group)) {
             group->series->setSelected(!group->series->isSelected());
             m_graph->polishAndUpdate();
             qreal x;
@@ -421,7 +465,7 @@ void AreaRenderer::onDoubleTapped(QEventPoint eventPoint, Qt::MouseButton button
         if (group->series->lowerSeries() && group->series->lowerSeries()->count() < 2)
             continue;
 
-        if (pointInArea(eventPoint.position().toPoint(), group->series)) {
+        if (pointInArea(eventPoint.position().toPoint(), group)) {
             qreal x;
             qreal y;
             calculateAxisCoordinates(eventPoint.position().x(), eventPoint.position().y(), &x, &y);
@@ -443,7 +487,7 @@ void AreaRenderer::onPressedChanged()
         if (group->series->lowerSeries() && group->series->lowerSeries()->count() < 2)
             continue;
 
-        if (pointInArea(position.toPoint(), group->series)) {
+        if (pointInArea(position.toPoint(), group)) {
             qreal x;
             qreal y;
             calculateAxisCoordinates(position.x(), position.y(), &x, &y);
@@ -47,6 +47,16 @@ private:
         QAreaSeries *series = nullptr;
         QQuickShapePath *shapePath = nullptr;
         QPainterPath painterPath;
+        // Render coordinates of the boundary with more points and of the other boundary,
+        // or of the baseline below the upper series. Quad i spans from point i to i + 1
+        // on both, and its horizontal extent is kept for binary searching when x is
+        // ordered along both boundaries.
+        QList<QPointF> firstPoints;
+        QList<QPointF> secondPoints;
+        QList<qreal> segmentMinX;
+        QList<qreal> segmentMaxX;
+        // 1 when x ascends along both boundaries, -1 when it descends, 0 otherwise
+        int xOrder = 0;
         qsizetype colorIndex = -1;
         qsizetype borderColorIndex = -1;
         bool hover = false;
@@ -72,7 +82,8 @@ private:
 
     void calculateRenderCoordinates(qreal origX, qreal origY, qreal *renderX, qreal *renderY) const;
     void calculateAxisCoordinates(qreal origX, qreal origY, qreal *axisX, qreal *axisY) const;
-    bool pointInArea(QPoint pt, QAreaSeries *series) const;
+    void updateHitTestPoints(PointGroup *group);
+    bool pointInArea(QPoint pt, const PointGroup *group) const;
 };
 
 QT_END_NAMESPACE
@@ -352,6 +352,9 @@ void AxisRenderer::updateAxis()
             item->deleteLater();
         m_yAxisTextItems.clear();
 
+        m_xAxisLabelCache.labels.clear();
+        m_yAxisLabelCache.labels.clear();
+
         m_wasVertical = vertical;
     }
 
@@ -860,6 +863,7 @@ void AxisRenderer::setLabelTextProperties(QQuickItem *item, const QString &text,
 #ifdef USE_BARGRAPH
 void AxisRenderer::updateBarXAxisLabels(QBarCategoryAxis *axis, const QRectF rect)
 {
+    m_xAxisLabelCache.labels.clear();
     qsizetype categoriesCount = axis->categories().size();
     // See if we need more text items
     updateAxisLabelItems(m_xAxisTextItems, categoriesCount, axis->labelDelegate());
@@ -895,6 +899,7 @@ void AxisRenderer::updateBarXAxisLabels(QBarCategoryAxis *axis, const QRectF rec
 
 void AxisRenderer::updateBarYAxisLabels(QBarCategoryAxis *axis, const QRectF rect)
 {
+    m_yAxisLabelCache.labels.clear();
     qsizetype categoriesCount = axis->categories().size();
     // See if we need more text items
     updateAxisLabelItems(m_yAxisTextItems, categoriesCount, axis->labelDelegate());
@@ -929,21 +934,96 @@ void AxisRenderer::updateBarYAxisLabels(QBarCategoryAxis *axis, const QRectF rec
 }
 #endif
 
+bool AxisRenderer::ValueLabelCache::hasSameFormat(const ValueLabelCache &other) const
+{
+    return valueStep == other.valueStep && tickAnchor == other.tickAnchor
+           && decimals == other.decimals && format == other.format
+           && font == other.font && color == other.color && flipped == other.flipped;
+}
+
+// Moves the text items which already show one of the labels firstLabel .. firstLabel + count - 1
+// into the index of that label, and marks the rest as needing new text.
+void AxisRenderer::reuseValueLabelItems(QList<QQuickItem *> &textItems, ValueLabelCache &cache,
+                                        const ValueLabelCache &format, qint64 firstLabel,
+                                        qsizetype count)
+{
+    if (cache.labels.size() != textItems.size() || !cache.hasSameFormat(format)) {
+        cache = format;
+        cache.labels.fill(ValueLabelCache::NoLabel, textItems.size());
+        return;
+    }
+
+    bool inPlace = true;
+    for (qsizetype i = 0; i < count && inPlace; ++i)
+        inPlace = cache.labels[i] == firstLabel + i;
+    if (inPlace)
+        return;
+
+    QList<QQuickItem *> items(textItems.size(), nullptr);
+    QList<qint64> labels(textItems.size(), ValueLabelCache::NoLabel);
+    QList<qsizetype> spareItems;
+    for (qsizetype i = 0; i < textItems.size(); ++i) {
+        const qint64 label = cache.labels[i];
+        const qint64 index = label - firstLabel;
+        if (label != ValueLabelCache::NoLabel && index >= 0 && index < count && !items[index]) {
+            items[index] = textItems[i];
+            labels[index] = label;
+        } else {
+            spareItems.append(i);
+        }
+    }
+    qsizetype spare = 0;
+    for (auto &item : items) {
+        if (!item)
+            item = textItems[spareItems[spare++]];
+    }
+    textItems = std::move(items);
+    cache.labels = std::move(labels);
+    // Items which showed a label that scrolled out of the range may have moved past it
+    for (qsizetype i = count; i < textItems.size(); ++i)
+        textItems[i]->setVisible(false);
+}
+
+QString AxisRenderer::formatValueLabel(QValueAxis *axis, double number, int decimals) const
+{
+    const QString f = axis->labelFormat();
+    if (f.length() <= 1) {
+        char format = f.isEmpty() ? 'f' : f.front().toLatin1();
+        return QString::number(number, format, decimals);
+    }
+    QByteArray array = f.toLatin1();
+    return QString::asprintf(array.constData(), number);
+}
+
 void AxisRenderer::updateValueYAxisLabels(QValueAxis *axis, const QRectF rect)
 {
-    // Create label values in the range
-    QList<double> yAxisLabelValues;
+    // Count label values in the range
+    qsizetype categoriesCount = 0;
     const int MAX_LABELS_COUNT = 100;
     for (double i = m_axisVerticalMinLabel; i <= m_axisVerticalMaxValue; i += m_axisVerticalValueStep) {
-        yAxisLabelValues << i;
-        if (yAxisLabelValues.size() >= MAX_LABELS_COUNT)
+        if (++categoriesCount >= MAX_LABELS_COUNT)
             break;
     }
-    qsizetype categoriesCount = yAxisLabelValues.size();
 
     // See if we need more text items
     updateAxisLabelItems(m_yAxisTextItems, categoriesCount, axis->labelDelegate());
 
+    int decimals = axis->labelDecimals();
+    if (decimals < 0)
+        decimals = getValueDecimalsFromRange(m_axisVerticalValueRange);
+    ValueLabelCache format;
+    format.valueStep = m_axisVerticalValueStep;
+    format.tickAnchor = axis->tickAnchor();
+    format.decimals = decimals;
+    format.format = axis->labelFormat();
+    format.font = theme()->axisYLabelFont();
+    format.color = theme()->axisY().labelTextColor();
+    format.flipped = m_verticalAxisOnRight;
+    // Labels are counted from the anchor, which they are laid out from
+    const qint64 firstLabel = qRound64((m_axisVerticalMinLabel - format.tickAnchor)
+                                       / m_axisVerticalValueStep);
+    reuseValueLabelItems(m_yAxisTextItems, m_yAxisLabelCache, format, firstLabel, categoriesCount);
+
     for (int i = 0;  i < categoriesCount; i++) {
         auto &textItem = m_yAxisTextItems[i];
         if (axis->isVisible() && axis->labelsVisible()) {
@@ -959,28 +1039,20 @@ void AxisRenderer::updateValueYAxisLabels(QValueAxis *axis, const QRectF rect)
             textItem->setY(posY);
             textItem->setWidth(rect.width());
             textItem->setRotation(axis->labelsAngle());
-            double number = yAxisLabelValues.at(i);
-            // Format the number
-            int decimals = axis->labelDecimals();
-            if (decimals < 0)
-                decimals = getValueDecimalsFromRange(m_axisVerticalValueRange);
-            const QString f = axis->labelFormat();
-            QString label;
-            if (f.length() <= 1) {
-              char format = f.isEmpty() ? 'f' : f.front().toLatin1();
-              label = QString::number(number, format, decimals);
-            } else {
-              QByteArray array = f.toLatin1();
-              label = QString::asprintf(array.constData(), number);
-            }
-            if (m_verticalAxisOnRight) {
-                setLabelTextProperties(textItem, label, false,
-                                       QQuickText::HAlignment::AlignLeft,
-                                       QQuickText::VAlignment::AlignVCenter);
-            } else {
-                setLabelTextProperties(textItem, label, false,
-                                       QQuickText::HAlignment::AlignRight,
-                                       QQuickText::VAlignment::AlignVCenter);
+            // Text, font and alignment only change when the item shows a different value
+            if (m_yAxisLabelCache.labels[i] != firstLabel + i) {
+                double number = m_axisVerticalMinLabel + i * m_axisVerticalValueStep;
+                const QString label = formatValueLabel(axis, number, decimals);
+                if (m_verticalAxisOnRight) {
+                    setLabelTextProperties(textItem, label, false,
+                                           QQuickText::HAlignment::AlignLeft,
+                                           QQuickText::VAlignment::AlignVCenter);
+                } else {
+                    setLabelTextProperties(textItem, label, false,
+                                           QQuickText::HAlignment::AlignRight,
+                                           QQuickText::VAlignment::AlignVCenter);
+                }
+                m_yAxisLabelCache.labels[i] = firstLabel + i;
             }
             textItem->setHeight(0);
             textItem->setVisible(true);
@@ -993,19 +1065,33 @@ void AxisRenderer::updateValueYAxisLabels(QValueAxis *axis, const QRectF rect)
 
 void AxisRenderer::updateValueXAxisLabels(QValueAxis *axis, const QRectF rect)
 {
-    // Create label values in the range
-    QList<double> axisLabelValues;
+    // Count label values in the range
+    qsizetype categoriesCount = 0;
     const int MAX_LABELS_COUNT = 100;
     for (double i = m_axisHorizontalMinLabel; i <= m_axisHorizontalMaxValue; i += m_axisHorizontalValueStep) {
-        axisLabelValues << i;
-        if (axisLabelValues.size() >= MAX_LABELS_COUNT)
+        if (++categoriesCount >= MAX_LABELS_COUNT)
             break;
     }
-    qsizetype categoriesCount = axisLabelValues.size();
 
     // See if we need more text items
     updateAxisLabelItems(m_xAxisTextItems, categoriesCount, axis->labelDelegate());
 
+    int decimals = axis->labelDecimals();
+    if (decimals < 0)
+        decimals = getValueDecimalsFromRange(m_axisHorizontalValueRange);
+    ValueLabelCache format;
+    format.valueStep = m_axisHorizontalValueStep;
+    format.tickAnchor = axis->tickAnchor();
+    format.decimals = decimals;
+    format.format = axis->labelFormat();
+    format.font = theme()->axisXLabelFont();
+    format.color = theme()->axisX().labelTextColor();
+    format.flipped = m_horizontalAxisOnTop;
+    // Labels are counted from the anchor, which they are laid out from
+    const qint64 firstLabel = qRound64((m_axisHorizontalMinLabel - format.tickAnchor)
+                                       / m_axisHorizontalValueStep);
+    reuseValueLabelItems(m_xAxisTextItems, m_xAxisLabelCache, format, firstLabel, categoriesCount);
+
     for (int i = 0;  i < categoriesCount; i++) {
         auto &textItem = m_xAxisTextItems[i];
         if (axis->isVisible() && axis->labelsVisible()) {
@@ -1024,28 +1110,20 @@ void AxisRenderer::updateValueXAxisLabels(QValueAxis *axis, const QRectF rect)
             textItem->setX(posX);
             textItem->setWidth(textItemWidth);
             textItem->setRotation(axis->labelsAngle());
-            double number = axisLabelValues.at(i);
-            // Format the number
-            int decimals = axis->labelDecimals();
-            if (decimals < 0)
-                decimals = getValueDecimalsFromRange(m_axisHorizontalValueRange);
-            const QString f = axis->labelFormat();
-            QString label;
-            if (f.length() <= 1) {
-              char format = f.isEmpty() ? 'f' : f.front().toLatin1();
-              label = QString::number(number, format, decimals);
-            } else {
-              QByteArray array = f.toLatin1();
-              label = QString::asprintf(array.constData(), number);
-            }
-            if (m_horizontalAxisOnTop) {
-                setLabelTextProperties(textItem, label, true,
-                                       QQuickText::HAlignment::AlignHCenter,
-                                       QQuickText::VAlignment::AlignBottom);
-            } else {
-                setLabelTextProperties(textItem, label, true,
-                                       QQuickText::HAlignment::AlignHCenter,
-                                       QQuickText::VAlignment::AlignTop);
+            // Text, font and alignment only change when the item shows a different value
+            if (m_xAxisLabelCache.labels[i] != firstLabel + i) {
+                double number = m_axisHorizontalMinLabel + i * m_axisHorizontalValueStep;
+                const QString label = formatValueLabel(axis, number, decimals);
+                if (m_horizontalAxisOnTop) {
+                    setLabelTextProperties(textItem, label, true,
+                                           QQuickText::HAlignment::AlignHCenter,
+                                           QQuickText::VAlignment::AlignBottom);
+                } else {
+                    setLabelTextProperties(textItem, label, true,
+                                           QQuickText::HAlignment::AlignHCenter,
+                                           QQuickText::VAlignment::AlignTop);
+                }
+                m_xAxisLabelCache.labels[i] = firstLabel + i;
             }
             textItem->setHeight(rect.height());
             textItem->setVisible(true);
@@ -1058,6 +1136,7 @@ void AxisRenderer::updateValueXAxisLabels(QValueAxis *axis, const QRectF rect)
 
 void AxisRenderer::updateDateTimeYAxisLabels(QDateTimeAxis *axis, const QRectF rect)
 {
+    m_yAxisLabelCache.labels.clear();
     auto maxDate = axis->max();
     auto minDate = axis->min();
     int dateTimeSize = m_axisVerticalMinLabel + 1;
@@ -1103,6 +1182,7 @@ void AxisRenderer::updateDateTimeYAxisLabels(QDateTimeAxis *axis, const QRectF r
 
 void AxisRenderer::updateDateTimeXAxisLabels(QDateTimeAxis *axis, const QRectF rect)
 {
+    m_xAxisLabelCache.labels.clear();
     auto maxDate = axis->max();
     auto minDate = axis->min();
     int dateTimeSize = m_axisHorizontalMinLabel + 1;
@@ -19,6 +19,7 @@
 #include <QList>
 #include <QList>
 #include <QtQuick/private/qquicktext_p.h>
+#include <limits>
 #include <private/axisgrid_p.h>
 #include <private/axisticker_p.h>
 #include <private/axisline_p.h>
@@ -79,6 +80,27 @@ private:
                                 QQuickText::HAlignment hAlign = QQuickText::HAlignment::AlignHCenter,
                                 QQuickText::VAlignment vAlign = QQuickText::VAlignment::AlignVCenter);
     void updateAxisLabelItems(QList<QQuickItem *> &textItems, qsizetype neededSize, QQmlComponent *component);
+
+    // Remembers which label value each value axis text item shows, so that panning
+    // only repositions the items instead of formatting and laying out text again.
+    struct ValueLabelCache
+    {
+        // Label index ((value - tickAnchor) / valueStep) shown by each text item, or NoLabel
+        QList<qint64> labels;
+        double valueStep = 0;
+        double tickAnchor = 0;
+        int decimals = 0;
+        QString format;
+        QFont font;
+        QColor color;
+        bool flipped = false;
+
+        static constexpr qint64 NoLabel = std::numeric_limits<qint64>::min();
+        bool hasSameFormat(const ValueLabelCache &other) const;
+    };
+    void reuseValueLabelItems(QList<QQuickItem *> &textItems, ValueLabelCache &cache,
+                              const ValueLabelCache &format, qint64 firstLabel, qsizetype count);
+    QString formatValueLabel(QValueAxis *axis, double number, int decimals) const;
     QVector2D windowToAxisCoords(QVector2D coords);
     bool zoom(qreal delta);
 
@@ -93,6 +115,8 @@ private:
     QAbstractAxis *m_axisHorizontal = nullptr;
     QList<QQuickItem *> m_xAxisTextItems;
     QList<QQuickItem *> m_yAxisTextItems;
+    ValueLabelCache m_xAxisLabelCache;
+    ValueLabelCache m_yAxisLabelCache;
     QQuickText *m_xAxisTitle = nullptr;
     QQuickText *m_yAxisTitle = nullptr;
     AxisGrid *m_axisGrid = nullptr;
@@ -3,6 +3,8 @@
 
 #include <QtQuick/private/qquickrectangle_p.h>
 #include <QtQuick/private/qquicktaphandler_p.h>
+#include <QtQuick/qsgnode.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
 #include <QtGraphs/qbarseries.h>
 #include <QtGraphs/qbarset.h>
 #include <private/barsrenderer_p.h>
@@ -10,6 +12,9 @@
 #include <private/qbarseries_p.h>
 #include <private/qgraphsview_p.h>
 
+#include <array>
+#include <cmath>
+
 QT_BEGIN_NAMESPACE
 
 static const char* TAG_BAR_COLOR = "barColor";
@@ -146,17 +151,20 @@ void BarsRenderer::positionLabelItem(QBarSeries *series, QQuickText *textItem, c
 
 void BarsRenderer::updateComponents(QBarSeries *series)
 {
+    if (!series->barDelegate()) {
+        updateDefaultBars(series);
+        return;
+    }
+    clearDefaultBars(series);
+
     int barIndex = 0;
     auto &seriesData = m_seriesData[series];
     auto &barItems = m_barItems[series];
     for (auto i = seriesData.cbegin(), end = seriesData.cend(); i != end; ++i) {
         if (barItems.size() <= barIndex) {
-            QQuickItem *item = nullptr;
             // Create more components as needed
-            if (series->barDelegate()) {
-                item = qobject_cast<QQuickItem *>(
-                        series->barDelegate()->create(series->barDelegate()->creationContext()));
-            }
+            auto item = qobject_cast<QQuickItem *>(
+                    series->barDelegate()->create(series->barDelegate()->creationContext()));
             if (!item)
                 item = new QQuickRectangle();
             item->setParent(this);
@@ -165,49 +173,198 @@ void BarsRenderer::updateComponents(QBarSeries *series)
         }
         if (barItems.size() > barIndex) {
             BarSeriesData d = *i;
-            if (series->barDelegate()) {
-                // Set custom bar components
-                auto &barItem = barItems[barIndex];
-                barItem->setX(d.rect.x());
-                barItem->setY(d.rect.y());
-                barItem->setWidth(d.rect.width());
-                barItem->setHeight(d.rect.height());
-                barItem->setVisible(series->isVisible());
-                // Check for specific dynamic properties
-                if (barItem->property(TAG_BAR_COLOR).isValid())
-                    barItem->setProperty(TAG_BAR_COLOR, d.color);
-                if (barItem->property(TAG_BAR_BORDER_COLOR).isValid())
-                    barItem->setProperty(TAG_BAR_BORDER_COLOR, d.borderColor);
-                if (barItem->property(TAG_BAR_BORDER_WIDTH).isValid())
-                    barItem->setProperty(TAG_BAR_BORDER_WIDTH, d.borderWidth);
-                if (barItem->property(TAG_BAR_SELECTED).isValid())
-                    barItem->setProperty(TAG_BAR_SELECTED, d.isSelected);
-                if (barItem->property(TAG_BAR_VALUE).isValid())
-                    barItem->setProperty(TAG_BAR_VALUE, d.value);
-                if (barItem->property(TAG_BAR_LABEL).isValid())
-                    barItem->setProperty(TAG_BAR_LABEL, d.label);
-                if (barItem->property(TAG_BAR_INDEX).isValid())
-                    barItem->setProperty(TAG_BAR_INDEX, barIndex);
-            } else {
-                // Set default rectangle bars
-                auto barItem = qobject_cast<QQuickRectangle *>(barItems[barIndex]);
-                if (barItem) {
-                    barItem->setX(d.rect.x());
-                    barItem->setY(d.rect.y());
-                    barItem->setWidth(d.rect.width());
-                    barItem->setHeight(d.rect.height());
-                    barItem->setVisible(series->isVisible());
-                    barItem->setColor(d.color);
-                    barItem->border()->setColor(d.borderColor);
-                    barItem->border()->setWidth(d.borderWidth);
-                    barItem->setRadius(4.0);
-                }
-            }
+            // Set custom bar components
+            auto &barItem = barItems[barIndex];
+            barItem->setX(d.rect.x());
+            barItem->setY(d.rect.y());
+            barItem->setWidth(d.rect.width());
+            barItem->setHeight(d.rect.height());
+            barItem->setVisible(series->isVisible());
+            // Check for specific dynamic properties
+            if (barItem->property(TAG_BAR_COLOR).isValid())
+                barItem->setProperty(TAG_BAR_COLOR, d.color);
+            if (barItem->property(TAG_BAR_BORDER_COLOR).isValid())
+                barItem->setProperty(TAG_BAR_BORDER_COLOR, d.borderColor);
+            if (barItem->property(TAG_BAR_BORDER_WIDTH).isValid())
+                barItem->setProperty(TAG_BAR_BORDER_WIDTH, d.borderWidth);
+            if (barItem->property(TAG_BAR_SELECTED).isValid())
+                barItem->setProperty(TAG_BAR_SELECTED, d.isSelected);
+            if (barItem->property(TAG_BAR_VALUE).isValid())
+                barItem->setProperty(TAG_BAR_VALUE, d.value);
+            if (barItem->property(TAG_BAR_LABEL).isValid())
+                barItem->setProperty(TAG_BAR_LABEL, d.label);
+            if (barItem->property(TAG_BAR_INDEX).isValid())
+                barItem->setProperty(TAG_BAR_INDEX, barIndex);
         }
         barIndex++;
     }
 }
 
+// Corners of rounded rectangles are approximated with a few steps, which is enough for
+// the small default radius.
+static constexpr int cornerSteps = 3;
+
+// Appends a rounded rectangle as horizontal strips of quads, top to bottom.
+static void appendRoundedRect(QList<QSGGeometry::ColoredPoint2D> &vertices,
+                              const QRectF &rect,
+                              qreal radius,
+                              QRgb color)
+{
+    const uchar r = qRed(color);
+    const uchar g = qGreen(color);
+    const uchar b = qBlue(color);
+    const uchar a = qAlpha(color);
+    auto appendRow = [&](qreal y, qreal inset) {
+        QSGGeometry::ColoredPoint2D vertex;
+        vertex.set(rect.left() + inset, y, r, g, b, a);
+        vertices << vertex;
+        vertex.set(rect.right() - inset, y, r, g, b, a);
+        vertices << vertex;
+    };
+
+    radius = qMin(radius, 0.5 * qMin(rect.width(), rect.height()));
+    if (radius < 0.5) {
+        appendRow(rect.top(), 0);
+        appendRow(rect.bottom(), 0);
+        return;
+    }
+
+    static const auto corner = [] {
+        std::array<QPointF, cornerSteps + 1> steps;
+        for (int i = 0; i <= cornerSteps; ++i) {
+            const qreal angle = M_PI_2 * i / cornerSteps;
+            steps[i] = QPointF(1.0 - std::sin(angle), 1.0 - std::cos(angle));
+        }
+        return steps;
+    }();
+
+    // Every pair of consecutive rows forms one quad, so the rows in between are repeated
+    for (int i = 0; i < cornerSteps; ++i) {
+        appendRow(rect.top() + corner[i].y() * radius, corner[i].x() * radius);
+        appendRow(rect.top() + corner[i + 1].y() * radius, corner[i + 1].x() * radius);
+    }
+    appendRow(rect.top() + radius, 0);
+    appendRow(rect.bottom() - radius, 0);
+    for (int i = cornerSteps; i > 0; --i) {
+        appendRow(rect.bottom() - corner[i].y() * radius, corner[i].x() * radius);
+        appendRow(rect.bottom() - corner[i - 1].y() * radius, corner[i - 1].x() * radius);
+    }
+}
+
+// Returns the outline of a rounded rectangle clockwise, starting from the left edge of
+// the top left corner. Every corner has the same number of points, also when the radius
+// is zero, so that the outlines of two rectangles can be joined point by point.
+static std::array<QPointF, 4 * (cornerSteps + 1)> roundedOutline(const QRectF &rect, qreal radius)
+{
+    // Same radius as appendRoundedRect() uses, so that the outline matches the fill
+    radius = qMin(radius, 0.5 * qMin(rect.width(), rect.height()));
+    if (radius < 0.5)
+        radius = 0;
+    const std::array<QPointF, 4> centers = {QPointF(rect.left() + radius, rect.top() + radius),
+                                            QPointF(rect.right() - radius, rect.top() + radius),
+                                            QPointF(rect.right() - radius, rect.bottom() - radius),
+                                            QPointF(rect.left() + radius, rect.bottom() - radius)};
+    std::array<QPointF, 4 * (cornerSteps + 1)> outline;
+    for (int c = 0; c < 4; ++c) {
+        for (int i = 0; i <= cornerSteps; ++i) {
+            const qreal angle = M_PI + M_PI_2 * (c + qreal(i) / cornerSteps);
+            outline[c * (cornerSteps + 1) + i] = centers[c]
+                                                 + radius * QPointF(std::cos(angle),
+                                                                    std::sin(angle));
+        }
+    }
+    return outline;
+}
+
+// Appends the border of a rounded rectangle as a ring of quads between its outline and
+// the outline of the inset fill, so that the border and the fill never overlap.
+static void appendRoundedBorder(QList<QSGGeometry::ColoredPoint2D> &vertices,
+                                const QRectF &rect,
+                                const QRectF &fillRect,
+                                qreal radius,
+                                qreal fillRadius,
+                                QRgb color)
+{
+    // A border wider than the rectangle covers all of it
+    QRectF innerRect = fillRect;
+    if (innerRect.width() < 0) {
+        innerRect.moveLeft(innerRect.center().x());
+        innerRect.setWidth(0);
+    }
+    if (innerRect.height() < 0) {
+        innerRect.moveTop(innerRect.center().y());
+        innerRect.setHeight(0);
+    }
+
+    const auto outer = roundedOutline(rect, radius);
+    const auto inner = roundedOutline(innerRect, fillRadius);
+    const uchar r = qRed(color);
+    const uchar g = qGreen(color);
+    const uchar b = qBlue(color);
+    const uchar a = qAlpha(color);
+    for (size_t i = 0; i < outer.size(); ++i) {
+        const size_t next = (i + 1) % outer.size();
+        QSGGeometry::ColoredPoint2D vertex;
+        vertex.set(outer[i].x(), outer[i].y(), r, g, b, a);
+        vertices << vertex;
+        vertex.set(outer[next].x(), outer[next].y(), r, g, b, a);
+        vertices << vertex;
+        vertex.set(inner[i].x(), inner[i].y(), r, g, b, a);
+        vertices << vertex;
+        vertex.set(inner[next].x(), inner[next].y(), r, g, b, a);
+        vertices << vertex;
+    }
+}
+
+void BarsRenderer::updateDefaultBars(QBarSeries *series)
+{
+    // Bars may have been delegate items before
+    auto &barItems = m_barItems[series];
+    for (auto item : std::as_const(barItems))
+        item->deleteLater();
+    barItems.clear();
+
+    // Same look as a QQuickRectangle with a border drawn inside its bounds
+    const qreal radius = 4.0;
+    auto &barNode = m_barNodes[series];
+    auto &vertices = barNode.vertices;
+    vertices.clear();
+    if (series->isVisible()) {
+        const auto &seriesData = m_seriesData[series];
+        for (const auto &d : seriesData) {
+            if (d.rect.width() <= 0 || d.rect.height() <= 0)
+                continue;
+            // QSGVertexColorMaterial expects premultiplied colors
+            QRectF fillRect = d.rect;
+            qreal fillRadius = radius;
+            if (d.borderWidth > 0 && d.borderColor.alpha() > 0) {
+                fillRect.adjust(d.borderWidth, d.borderWidth, -d.borderWidth, -d.borderWidth);
+                fillRadius = qMax(0.0, radius - d.borderWidth);
+                appendRoundedBorder(vertices,
+                                    d.rect,
+                                    fillRect,
+                                    radius,
+                                    fillRadius,
+                                    qPremultiply(d.borderColor.rgba()));
+            }
+            if (fillRect.width() > 0 && fillRect.height() > 0)
+                appendRoundedRect(vertices, fillRect, fillRadius, qPremultiply(d.color.rgba()));
+        }
+    }
+    barNode.dirty = true;
+    update();
+}
+
+void BarsRenderer::clearDefaultBars(QBarSeries *series)
+{
+    auto it = m_barNodes.find(series);
+    if (it == m_barNodes.end() || it->vertices.isEmpty())
+        return;
+    it->vertices.clear();
+    it->dirty = true;
+    update();
+}
+
 void BarsRenderer::updateValueLabels(QBarSeries *series)
 {
     if (!series->barDelegate() && series->isVisible() && series->labelsVisible()) {
@@ -255,13 +412,10 @@ void calculateCategoryTotalValues(QBarSeries *series, QList<float> &totalValues,
 {
     totalValues.fill(0, valuesPerSet);
     for (auto s : series->barSets()) {
-        QVariantList v = s->values();
-        int setIndex = 0;
-        for (auto variantValue : std::as_const(v)) {
-            if (setIndex < totalValues.size())
-                totalValues[setIndex] += variantValue.toReal();
-            setIndex++;
-        }
+        const auto &values = s->realValues();
+        const qsizetype count = qMin(values.size(), totalValues.size());
+        for (qsizetype setIndex = 0; setIndex < count; ++setIndex)
+            totalValues[setIndex] += values[setIndex];
     }
 }
 
@@ -304,8 +458,8 @@ void BarsRenderer::updateVerticalBars(QBarSeries *series, qsizetype setCount, qs
     int barSeriesIndex = 0;
     QList<QLegendData> legendDataList;
     for (auto s : series->barSets()) {
-        QVariantList v = s->values();
-        qsizetype valuesCount = v.size();
+        const auto &values = s->realValues();
+        qsizetype valuesCount = values.size();
         if (valuesCount == 0)
             continue;
         seriesPos = 0;
@@ -331,15 +485,13 @@ void BarsRenderer::updateVerticalBars(QBarSeries *series, qsizetype setCount, qs
         // Apply series opacity
         color.setAlpha(color.alpha() * series->opacity());
         borderColor.setAlpha(borderColor.alpha() * series->opacity());
-        const auto selectedBars = s->selectedBars();
-        for (auto variantValue : std::as_const(v)) {
-            const float realValue = variantValue.toReal();
+        for (const float realValue : values) {
             float value = (realValue - m_graph->m_axisRenderer->m_axisVerticalMinValue) * series->valuesMultiplier();
             if (percent) {
                 if (auto totalValue = totalValuesListInSet.at(barIndexInSet))
                     value *= (100.0 / totalValue);
             }
-            const bool isSelected = selectedBars.contains(barIndexInSet);
+            const bool isSelected = s->isBarSelected(barIndexInSet);
             double delta = m_graph->m_axisRenderer->m_axisVerticalMaxValue - m_graph->m_axisRenderer->m_axisVerticalMinValue;
             double maxValues = delta > 0 ? 1.0 / delta : 100.0;
             float barLength = h * value * maxValues;
@@ -414,8 +566,8 @@ void BarsRenderer::updateHorizontalBars(QBarSeries *series, qsizetype setCount,
     int barSerieIndex = 0;
     QList<QLegendData> legendDataList;
     for (auto s : series->barSets()) {
-        QVariantList v = s->values();
-        qsizetype valuesCount = v.size();
+        const auto &values = s->realValues();
+        qsizetype valuesCount = values.size();
         if (valuesCount == 0)
             continue;
         seriesPos = 0;
@@ -440,15 +592,13 @@ void BarsRenderer::updateHorizontalBars(QBarSeries *series, qsizetype setCount,
         // Apply series opacity
         color.setAlpha(color.alpha() * series->opacity());
         borderColor.setAlpha(borderColor.alpha() * series->opacity());
-        const auto selectedBars = s->selectedBars();
-        for (auto variantValue : std::as_const(v)) {
-            const float realValue = variantValue.toReal();
+        for (const float realValue : values) {
             float value = (realValue - m_graph->m_axisRenderer->m_axisHorizontalMinValue) * series->valuesMultiplier();
             if (percent) {
                 if (auto totalValue = totalValuesListInSet.at(barIndexInSet))
                     value *= (100.0 / totalValue);
             }
-            const bool isSelected = selectedBars.contains(barIndexInSet);
+            const bool isSelected = s->isBarSelected(barIndexInSet);
             double delta = m_graph->m_axisRenderer->m_axisHorizontalMaxValue - m_graph->m_axisRenderer->m_axisHorizontalMinValue;
             double maxValues = delta > 0 ? 1.0 / delta : 100.0;
             float barLength = w * value * maxValues;
@@ -502,6 +652,7 @@ void BarsRenderer::handlePolish(QBarSeries *series)
         for (int i = 0; i < barItems.size(); i++)
             barItems[i]->deleteLater();
         barItems.clear();
+        clearDefaultBars(series);
 
         series->d_func()->clearLegendData();
         rectNodesInputRects.clear();
@@ -522,7 +673,7 @@ void BarsRenderer::handlePolish(QBarSeries *series)
     }
 
     // Get bars values
-    qsizetype valuesPerSet = series->barSets().first()->values().size();
+    qsizetype valuesPerSet = series->barSets().first()->count();
     if (m_graph->orientation() == Qt::Orientation::Vertical)
         updateVerticalBars(series, setCount, valuesPerSet);
     else
@@ -568,9 +719,81 @@ void BarsRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
             labelTextItems.clear();
             m_labelTextItems.remove(series);
         }
+        if (series && m_barNodes.contains(series)) {
+            // Remove default bars
+            if (auto node = m_barNodes.value(series).node) {
+                m_removedNodes << node;
+                update();
+            }
+            m_barNodes.remove(series);
+        }
     }
 }
 
+QSGNode *BarsRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData);
+
+    QSGNode *root = oldNode;
+    if (!root) {
+        // Any earlier nodes went away with the previous root
+        root = new QSGNode();
+        m_removedNodes.clear();
+        for (auto &barNode : m_barNodes) {
+            barNode.node = nullptr;
+            barNode.dirty = !barNode.vertices.isEmpty();
+        }
+    }
+
+    for (auto node : std::as_const(m_removedNodes)) {
+        root->removeChildNode(node);
+        delete node;
+    }
+    m_removedNodes.clear();
+
+    for (auto &barNode : m_barNodes) {
+        if (!barNode.dirty)
+            continue;
+        barNode.dirty = false;
+        if (!barNode.node) {
+            barNode.node = new QSGGeometryNode();
+            auto geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(),
+                                            0,
+                                            0,
+                                            QSGGeometry::UnsignedIntType);
+            geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+            barNode.node->setGeometry(geometry);
+            barNode.node->setFlag(QSGNode::OwnsGeometry);
+            barNode.node->setMaterial(new QSGVertexColorMaterial());
+            barNode.node->setFlag(QSGNode::OwnsMaterial);
+            root->appendChildNode(barNode.node);
+        }
+
+        const auto &vertices = barNode.vertices;
+        const qsizetype quadCount = vertices.size() / 4;
+        auto geometry = barNode.node->geometry();
+        geometry->allocate(vertices.size(), quadCount * 6);
+        if (!vertices.isEmpty()) {
+            memcpy(geometry->vertexDataAsColoredPoint2D(),
+                   vertices.constData(),
+                   vertices.size() * sizeof(QSGGeometry::ColoredPoint2D));
+        }
+        quint32 *indices = geometry->indexDataAsUInt();
+        for (qsizetype i = 0; i < quadCount; ++i) {
+            const quint32 first = quint32(i * 4);
+            *indices++ = first;
+            *indices++ = first + 1;
+            *indices++ = first + 2;
+            *indices++ = first + 2;
+            *indices++ = first + 1;
+            *indices++ = first + 3;
+        }
+        barNode.node->markDirty(QSGNode::DirtyGeometry);
+    }
+
+    return root;
+}
+
 bool BarsRenderer::handleHoverMove(QHoverEvent *event)
 {
     bool handled = false;
@@ -16,6 +16,7 @@
 
 #include <QQuickItem>
 #include <QtQuick/private/qquicktext_p.h>
+#include <QtQuick/qsggeometry.h>
 #include <QtCore/QHash>
 #include <QtCore/QList>
 #include <QtCore/QRectF>
@@ -28,6 +29,7 @@ class QBarSeries;
 class QBarSet;
 class QAbstractSeries;
 class QQuickTapHandler;
+class QSGGeometryNode;
 
 class BarsRenderer : public QQuickItem
 {
@@ -42,6 +44,9 @@ public:
     void afterPolish(QList<QAbstractSeries *> &cleanupSeries);
     bool handleHoverMove(QHoverEvent *event);
 
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
+
 Q_SIGNALS:
 
 private:
@@ -60,6 +65,12 @@ private:
         float borderWidth;
         bool isSelected;
     };
+    // Bars of a series without a barDelegate, drawn as colored quads of a single node
+    struct BarNodeData {
+        QList<QSGGeometry::ColoredPoint2D> vertices;
+        QSGGeometryNode *node = nullptr;
+        bool dirty = false;
+    };
 
     void updateVerticalBars(QBarSeries *series, qsizetype setCount, qsizetype valuesPerSet);
     void updateHorizontalBars(QBarSeries *series, qsizetype setCount, qsizetype valuesPerSet);
@@ -70,6 +81,8 @@ private:
     QString generateLabelText(QBarSeries *series, qreal value);
     void positionLabelItem(QBarSeries *series, QQuickText *textItem, const BarSeriesData &d);
     void updateComponents(QBarSeries *series);
+    void updateDefaultBars(QBarSeries *series);
+    void clearDefaultBars(QBarSeries *series);
     void updateValueLabels(QBarSeries *series);
 
     void onSingleTapped(QEventPoint eventPoint, Qt::MouseButton button);
@@ -79,6 +92,8 @@ private:
     QGraphsView *m_graph = nullptr;
     QHash<QBarSeries *, QList<BarSelectionRect>> m_rectNodesInputRects;
     QHash<QBarSeries *, QList<QQuickItem *>> m_barItems;
+    QHash<QBarSeries *, BarNodeData> m_barNodes;
+    QList<QSGNode *> m_removedNodes;
     QHash<QBarSeries *, QList<QQuickText *>> m_labelTextItems;
     QHash<QBarSeries *, QList<BarSeriesData>> m_seriesData;
 
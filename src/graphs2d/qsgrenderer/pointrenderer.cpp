@@ -12,12 +12,18 @@
 #endif
 #include <QtQuick/private/qquickdraghandler_p.h>
 #include <QtQuick/private/qquicktaphandler_p.h>
+#include <QtQuick/qsgnode.h>
+#include <QtQuick/qsgvertexcolormaterial.h>
 #include <private/axisrenderer_p.h>
 #include <private/pointrenderer_p.h>
 #include <private/qabstractseries_p.h>
 #include <private/qgraphsview_p.h>
 #include <private/qxyseries_p.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+
 QT_BEGIN_NAMESPACE
 
 static const char *TAG_POINT_COLOR = "pointColor";
@@ -29,6 +35,27 @@ static const char *TAG_POINT_VALUE_X = "pointValueX";
 static const char *TAG_POINT_VALUE_Y = "pointValueY";
 static const char *TAG_POINT_INDEX = "pointIndex";
 
+// Drags the default markers, which don't have per-point drag handlers. Only drags that start
+// on a draggable marker are taken, so that the others reach the axis panning.
+class MarkerDragHandler : public QQuickDragHandler
+{
+public:
+    explicit MarkerDragHandler(PointRenderer *renderer)
+        : QQuickDragHandler(renderer)
+        , m_renderer(renderer)
+    {}
+
+protected:
+    bool wantsEventPoint(const QPointerEvent *event, const QEventPoint &point) override
+    {
+        return QQuickDragHandler::wantsEventPoint(event, point)
+               && (active() || m_renderer->hasDraggableMarkerAt(point.pressPosition()));
+    }
+
+private:
+    PointRenderer *m_renderer;
+};
+
 PointRenderer::PointRenderer(QGraphsView *graph)
     : QQuickItem(graph)
     , m_graph(graph)
@@ -37,25 +64,8 @@ PointRenderer::PointRenderer(QGraphsView *graph)
     setClip(true);
     m_shape.setParentItem(this);
     m_shape.setPreferredRendererType(QQuickShape::CurveRenderer);
-
-    const QString qmlData = QLatin1StringView(R"QML(
-        import QtQuick;
-
-        Rectangle {
-            property bool pointSelected
-            property color pointColor
-            property color pointBorderColor
-            property color pointSelectedColor
-            property real pointBorderWidth
-            color: pointSelected ? pointSelectedColor : pointColor
-            border.color: pointBorderColor
-            border.width: pointBorderWidth
-            width: %1
-            height: %1
-        }
-    )QML").arg(QString::number((int) defaultSize()));
-    m_tempMarker = new QQmlComponent(qmlEngine(m_graph), this);
-    m_tempMarker->setData(qmlData.toUtf8(), QUrl());
+    // Default markers are drawn as content of this item, keep lines below them
+    m_shape.setZ(-1);
 
     m_tapHandler = new QQuickTapHandler(this);
     connect(m_tapHandler, &QQuickTapHandler::singleTapped,
@@ -64,6 +74,30 @@ PointRenderer::PointRenderer(QGraphsView *graph)
             this, &PointRenderer::onDoubleTapped);
     connect(m_tapHandler, &QQuickTapHandler::pressedChanged,
             this, &PointRenderer::onPressedChanged);
+    // A drag handler taking over the press cancels the tap, and then owns the pressed point
+    connect(m_tapHandler, &QQuickTapHandler::canceled, this, [this]() { m_pressCanceled = true; });
+
+    m_dragHandler = new MarkerDragHandler(this);
+    m_dragHandler->setTarget(nullptr);
+    m_dragHandler->setEnabled(false);
+    connect(m_dragHandler, &QQuickDragHandler::translationChanged, this, [this]() {
+        if (m_pressedGroup && !m_pressedGroup->currentMarker
+            && m_pressedGroup->series->isDraggable()) {
+            dragPressedPoint(m_dragHandler->activeTranslation().toPoint());
+        }
+    });
+    connect(m_dragHandler,
+            &QQuickDragHandler::grabChanged,
+            this,
+            [this](QPointingDevice::GrabTransition transition, QEventPoint point) {
+                Q_UNUSED(point)
+
+                if (transition == QPointingDevice::UngrabExclusive
+                    || transition == QPointingDevice::UngrabPassive) {
+                    m_previousDelta = QPoint(0, 0);
+                    m_pressedGroup = nullptr;
+                }
+            });
 }
 
 PointRenderer::~PointRenderer()
@@ -118,6 +152,396 @@ void PointRenderer::reverseRenderCoordinates(
              / (-1 * m_areaHeight * flipY * m_maxVertical);
 }
 
+// Keeps only the first, minimum, maximum and last point of each pixel column, in their
+// original order (M4 decimation).
+static QList<QPointF> decimatePoints(const QList<QPointF> &points)
+{
+    QList<QPointF> decimated;
+    qsizetype i = 0;
+    while (i < points.size()) {
+        const qreal column = std::floor(points[i].x());
+        const qsizetype start = i;
+        qsizetype minIndex = i;
+        qsizetype maxIndex = i;
+        while (++i < points.size() && std::floor(points[i].x()) == column) {
+            if (points[i].y() < points[minIndex].y())
+                minIndex = i;
+            if (points[i].y() > points[maxIndex].y())
+                maxIndex = i;
+        }
+
+        std::array<qsizetype, 4> indices = { start, minIndex, maxIndex, i - 1 };
+        std::sort(indices.begin(), indices.end());
+        qsizetype previous = -1;
+        for (qsizetype index : indices) {
+            if (index != previous)
+                decimated << points[index];
+            previous = index;
+        }
+    }
+    return decimated;
+}
+
+static void appendDecimatedPath(QPainterPath &path, const QList<QPointF> &points)
+{
+    for (const QPointF &point : decimatePoints(points)) {
+        if (path.elementCount() == 0)
+            path.moveTo(point);
+        else
+            path.lineTo(point);
+    }
+}
+
+using LineColor = std::array<uchar, 4>;
+
+static void appendQuad(QList<QSGGeometry::ColoredPoint2D> &vertices,
+                       std::array<QPointF, 4> corners,
+                       std::array<LineColor, 4> colors)
+{
+    for (int i = 0; i < 4; ++i) {
+        QSGGeometry::ColoredPoint2D vertex;
+        vertex.set(corners[i].x(), corners[i].y(),
+                   colors[i][0], colors[i][1], colors[i][2], colors[i][3]);
+        vertices << vertex;
+    }
+}
+
+// Appends a cap at the end point of a line leaving in the unit direction. Triangles are
+// stored as quads with a repeated last corner, so all line vertices share one index layout.
+static void appendLineCap(QList<QSGGeometry::ColoredPoint2D> &vertices,
+                          QPointF point,
+                          QPointF direction,
+                          qreal halfWidth,
+                          Qt::PenCapStyle capStyle,
+                          const LineColor &color)
+{
+    const QPointF normal(-direction.y(), direction.x());
+    if (capStyle == Qt::SquareCap) {
+        appendQuad(vertices,
+                   { point + normal * halfWidth,
+                     point - normal * halfWidth,
+                     point + (normal + direction) * halfWidth,
+                     point - (normal - direction) * halfWidth },
+                   { color, color, color, color });
+    } else if (capStyle == Qt::RoundCap) {
+        const int steps = 8;
+        QPointF previous = point + normal * halfWidth;
+        for (int i = 1; i <= steps; ++i) {
+            const qreal angle = M_PI * i / steps;
+            const QPointF next = point
+                                 + (normal * std::cos(angle) + direction * std::sin(angle))
+                                       * halfWidth;
+            appendQuad(vertices, { point, previous, next, next }, { color, color, color, color });
+            previous = next;
+        }
+    }
+}
+
+// Expands the segments of a polyline, starting from the one leaving points[firstSegment],
+// into quads. Each segment has a solid core with a one pixel feather on both sides for
+// antialiasing, and the outer side of each joint is filled with a bevel. The number of
+// vertices of each segment, including the joint leading into it, is appended to
+// segmentVertexCounts.
+static void appendLineSegments(QList<QSGGeometry::ColoredPoint2D> &vertices,
+                               QList<qsizetype> &segmentVertexCounts,
+                               const QList<QPointF> &points,
+                               qsizetype firstSegment,
+                               qreal halfWidth,
+                               const LineColor &color)
+{
+    const LineColor clear = {};
+    const qreal feather = 1.0;
+    QPointF previousNormal;
+    if (firstSegment > 0) {
+        const QPointF d = points[firstSegment] - points[firstSegment - 1];
+        const qreal length = std::hypot(d.x(), d.y());
+        if (length > 0)
+            previousNormal = QPointF(-d.y(), d.x()) / length;
+    }
+
+    for (qsizetype i = firstSegment; i + 1 < points.size(); ++i) {
+        const QPointF p = points[i];
+        const QPointF q = points[i + 1];
+        const QPointF d = q - p;
+        const qreal length = std::hypot(d.x(), d.y());
+        if (length <= 0) {
+            segmentVertexCounts << 0;
+            continue;
+        }
+        const qsizetype segmentStart = vertices.size();
+        const QPointF n = QPointF(-d.y(), d.x()) / length;
+        const QPointF core = n * halfWidth;
+        const QPointF edge = n * (halfWidth + feather);
+
+        if (!previousNormal.isNull()) {
+            const qreal turn = previousNormal.x() * n.y() - previousNormal.y() * n.x();
+            const qreal side = turn > 0 ? -halfWidth : halfWidth;
+            const QPointF a = p + previousNormal * side;
+            const QPointF b = p + n * side;
+            appendQuad(vertices, { p, a, b, b }, { color, color, color, color });
+        }
+
+        appendQuad(vertices, { p + core, p - core, q + core, q - core },
+                   { color, color, color, color });
+        appendQuad(vertices, { p + edge, p + core, q + edge, q + core },
+                   { clear, color, clear, color });
+        appendQuad(vertices, { p - core, p - edge, q - core, q - edge },
+                   { color, clear, color, clear });
+        segmentVertexCounts << vertices.size() - segmentStart;
+        previousNormal = n;
+    }
+}
+
+// Finds the unit direction in which the polyline leaves its first or last point
+static QPointF lineEndDirection(const QList<QPointF> &points, bool atEnd)
+{
+    for (qsizetype i = 1; i < points.size(); ++i) {
+        const QPointF d = atEnd ? points[points.size() - i] - points[points.size() - i - 1]
+                                : points[i - 1] - points[i];
+        const qreal length = std::hypot(d.x(), d.y());
+        if (length > 0)
+            return d / length;
+    }
+    return QPointF(atEnd ? 1 : -1, 0);
+}
+
+bool PointRenderer::shouldDecimate(qsizetype pointCount) const
+{
+    // M4 produces at most 4 points per pixel column
+    return pointCount > 4 * qCeil(m_areaWidth);
+}
+
+// The axis range is recomputed from the panned center, which moves it by an ulp or so
+// on most pans, so the scales only need to match up to rounding
+static bool isSameMapping(const std::array<qreal, 6> &a, const std::array<qreal, 6> &b)
+{
+    return a[0] == b[0] && a[1] == b[1] && qFuzzyCompare(a[2], b[2]) && qFuzzyCompare(a[3], b[3])
+           && a[4] == b[4] && a[5] == b[5];
+}
+
+// Maps the points of the series into group->renderPoints and the default marker
+// rectangles into group->rects. When the series has only been appended to or trimmed
+// from the front since the previous call, and the mapping has not changed apart from
+// a pan, the existing coordinates are kept and only the new points are mapped. The pan
+// is left in group->translation. Returns the index of the first mapped point and sets
+// removedFront to the number of points dropped from the front of the reused coordinates.
+qsizetype PointRenderer::mapPoints(QXYSeries *series, PointGroup *group, qsizetype *removedFront)
+{
+    auto d = series->d_func();
+    const auto &points = d->m_points;
+    auto axisRenderer = m_graph->m_axisRenderer;
+    const qreal flipX = axisRenderer->m_axisHorizontalMaxValue
+                                < axisRenderer->m_axisHorizontalMinValue
+                            ? -1
+                            : 1;
+    const qreal flipY = axisRenderer->m_axisVerticalMaxValue < axisRenderer->m_axisVerticalMinValue
+                            ? -1
+                            : 1;
+    const qreal size = defaultSize(series);
+    const std::array<qreal, 6> state = { m_areaWidth,
+                                         m_areaHeight,
+                                         m_maxHorizontal * flipX,
+                                         m_maxVertical * flipY,
+                                         series->valuesMultiplier(),
+                                         size };
+    const QPointF offset(m_horizontalOffset, m_verticalOffset);
+    // Splines map their control points with the current offsets, so they can't be panned
+    const bool translatable = series->type() != QAbstractSeries::SeriesType::Spline;
+
+    auto &renderPoints = group->renderPoints;
+    const qsizetype removed = d->m_pendingRemovedFront;
+    // Animations modify the points without emitting the change signals
+    const bool reuse = !d->m_pendingFullUpdate && !d->m_graphTransition
+                       && isSameMapping(state, group->mappingState)
+                       && (translatable || offset == group->mappedOffset)
+                       && removed <= renderPoints.size()
+                       && renderPoints.size() == group->rects.size()
+                       && renderPoints.size() - removed + d->m_pendingAppended == points.size();
+
+    d->m_pendingRemovedFront = 0;
+    d->m_pendingAppended = 0;
+    d->m_pendingFullUpdate = false;
+    // Reused coordinates stay relative to the state they were mapped with, so that
+    // rounding differences can't accumulate over many pans
+    if (!reuse) {
+        group->mappingState = state;
+        group->mappedOffset = offset;
+    }
+
+    const QPointF translation(group->mappedOffset.x() - offset.x(),
+                              (offset.y() - group->mappedOffset.y()) * state[4]);
+    if (translation != group->translation) {
+        group->translation = translation;
+        update();
+    }
+
+    qsizetype first = 0;
+    *removedFront = 0;
+    if (reuse) {
+        renderPoints.remove(0, removed);
+        group->rects.remove(0, removed);
+        first = renderPoints.size();
+        *removedFront = removed;
+    }
+
+    renderPoints.resize(points.size());
+    group->rects.resize(points.size());
+    for (qsizetype i = first; i < points.size(); ++i) {
+        qreal x, y;
+        calculateRenderCoordinates(axisRenderer, points[i].x(), points[i].y(), &x, &y);
+        y *= state[4];
+        x -= translation.x();
+        y -= translation.y();
+        renderPoints[i] = QPointF(x, y);
+        group->rects[i] = QRectF(x - size / 2.0, y - size / 2.0, size, size);
+    }
+    if (first < points.size() || removed > 0)
+        group->hitIndexDirty = true;
+
+    return first;
+}
+
+static int xOrderOf(const QList<QPointF> &points)
+{
+    bool ascending = true;
+    bool descending = true;
+    for (qsizetype i = 1; i < points.size() && (ascending || descending); ++i) {
+        ascending &= points[i - 1].x() <= points[i].x();
+        descending &= points[i - 1].x() >= points[i].x();
+    }
+    return ascending ? 1 : (descending ? -1 : 0);
+}
+
+// Finds the range [first, last) of segments between consecutive points which can
+// overlap the horizontal range [minX, maxX]. All segments are returned when the
+// x coordinates of the points are not ordered.
+static void segmentRange(const QList<QPointF> &points,
+                         int xOrder,
+                         qreal minX,
+                         qreal maxX,
+                         qsizetype *first,
+                         qsizetype *last)
+{
+    *first = 0;
+    *last = qMax(qsizetype(0), points.size() - 1);
+    if (xOrder == 0 || points.size() < 2)
+        return;
+
+    qsizetype begin, end;
+    if (xOrder > 0) {
+        begin = std::partition_point(points.begin(), points.end(),
+                                     [minX](const QPointF &p) { return p.x() < minX; })
+                - points.begin();
+        end = std::partition_point(points.begin(), points.end(),
+                                   [maxX](const QPointF &p) { return p.x() <= maxX; })
+              - points.begin();
+    } else {
+        begin = std::partition_point(points.begin(), points.end(),
+                                     [maxX](const QPointF &p) { return p.x() > maxX; })
+                - points.begin();
+        end = std::partition_point(points.begin(), points.end(),
+                                   [minX](const QPointF &p) { return p.x() >= minX; })
+              - points.begin();
+    }
+    // The segment ending at the first point in range overlaps it too
+    *first = qMax(qsizetype(0), begin - 1);
+    *last = qMin(*last, end);
+}
+
+void PointRenderer::updateHitIndex(PointGroup *group)
+{
+    if (!group->hitIndexDirty)
+        return;
+    group->hitIndexDirty = false;
+
+    const auto &rects = group->rects;
+    qreal maxExtent = 1;
+    QRectF bounds;
+    for (const QRectF &rect : rects) {
+        maxExtent = qMax(maxExtent, qMax(rect.width(), rect.height()));
+        bounds |= rect;
+    }
+
+    // The grid covers the rects themselves rather than the plot area, as panning moves
+    // the group translation and leaves the rects outside of it.
+    // A cell is at least as large as a marker, so that a marker containing a position
+    // is always bucketed in the cell of the position or in one of its neighbours.
+    // The grid is kept at roughly one cell per marker.
+    const qreal boundsWidth = qMax(qreal(1), bounds.width());
+    const qreal boundsHeight = qMax(qreal(1), bounds.height());
+    group->gridOrigin = bounds.topLeft();
+    const qreal boundsArea = boundsWidth * boundsHeight;
+    group->gridCellSize = qMax(maxExtent, qSqrt(boundsArea / qMax(qsizetype(1), rects.size())));
+    group->gridColumns = qCeil(boundsWidth / group->gridCellSize);
+    group->gridRows = qCeil(boundsHeight / group->gridCellSize);
+
+    auto cellOf = [group](QPointF position) {
+        position -= group->gridOrigin;
+        const qsizetype column = qBound(qsizetype(0),
+                                        qsizetype(std::floor(position.x() / group->gridCellSize)),
+                                        group->gridColumns - 1);
+        const qsizetype row = qBound(qsizetype(0),
+                                     qsizetype(std::floor(position.y() / group->gridCellSize)),
+                                     group->gridRows - 1);
+        return row * group->gridColumns + column;
+    };
+
+    auto &cellStart = group->gridCellStart;
+    cellStart.fill(0, group->gridColumns * group->gridRows + 1);
+    for (const QRectF &rect : rects)
+        cellStart[cellOf(rect.center()) + 1]++;
+    for (qsizetype i = 1; i < cellStart.size(); ++i)
+        cellStart[i] += cellStart[i - 1];
+
+    auto &indices = group->gridIndices;
+    indices.resize(rects.size());
+    QList<qsizetype> fill(cellStart.begin(), cellStart.end() - 1);
+    for (qsizetype i = 0; i < rects.size(); ++i)
+        indices[fill[cellOf(rects[i].center())]++] = i;
+
+    if (group->series->type() == QAbstractSeries::SeriesType::Spline) {
+        group->hoverPolygon = group->painterPath.toSubpathPolygons().value(0);
+        group->xOrder = xOrderOf(group->hoverPolygon);
+    } else if (group->series->type() == QAbstractSeries::SeriesType::Line) {
+        group->hoverPolygon.clear();
+        group->xOrder = xOrderOf(group->renderPoints);
+    }
+}
+
+// Returns the indices of the points whose rects contain the position, in ascending order
+QList<qsizetype> PointRenderer::pointsAt(PointGroup *group, QPointF position)
+{
+    updateHitIndex(group);
+    position -= group->translation;
+
+    QList<qsizetype> result;
+    if (group->gridIndices.isEmpty())
+        return result;
+
+    const QPointF gridPosition = position - group->gridOrigin;
+    const qsizetype column = qBound(qsizetype(0),
+                                    qsizetype(std::floor(gridPosition.x() / group->gridCellSize)),
+                                    group->gridColumns - 1);
+    const qsizetype row = qBound(qsizetype(0),
+                                 qsizetype(std::floor(gridPosition.y() / group->gridCellSize)),
+                                 group->gridRows - 1);
+
+    for (qsizetype r = qMax(qsizetype(0), row - 1); r <= qMin(group->gridRows - 1, row + 1); ++r) {
+        for (qsizetype c = qMax(qsizetype(0), column - 1);
+             c <= qMin(group->gridColumns - 1, column + 1);
+             ++c) {
+            const qsizetype cell = r * group->gridColumns + c;
+            for (qsizetype i = group->gridCellStart[cell]; i < group->gridCellStart[cell + 1]; ++i) {
+                const qsizetype index = group->gridIndices[i];
+                if (group->rects[index].contains(position))
+                    result << index;
+            }
+        }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
 PointRenderer::SeriesStyle PointRenderer::getSeriesStyle(PointGroup *group)
 {
     auto theme = m_graph->theme();
@@ -170,14 +594,18 @@ void PointRenderer::updatePointDelegate(
     if (marker->property(TAG_POINT_INDEX).isValid())
         marker->setProperty(TAG_POINT_INDEX, pointIndex);
 
-    marker->setX(x - marker->width() / 2.0);
-    marker->setY(y - marker->height() / 2.0);
+    marker->setX(x + group->translation.x() - marker->width() / 2.0);
+    marker->setY(y + group->translation.y() - marker->height() / 2.0);
     marker->setVisible(true);
 
-    rect = QRectF(x - marker->width() / 2.0,
-                  y - marker->height() / 2.0,
-                  marker->width(),
-                  marker->height());
+    const QRectF markerRect(x - marker->width() / 2.0,
+                            y - marker->height() / 2.0,
+                            marker->width(),
+                            marker->height());
+    if (rect != markerRect) {
+        rect = markerRect;
+        group->hitIndexDirty = true;
+    }
 }
 
 void PointRenderer::hidePointDelegates(QXYSeries *series)
@@ -190,6 +618,107 @@ void PointRenderer::hidePointDelegates(QXYSeries *series)
         }
     }
     group->rects.clear();
+    group->hitIndexDirty = true;
+    if (!group->markerVertices.isEmpty()) {
+        group->markerVertices.clear();
+        group->markersDirty = true;
+        update();
+    }
+}
+
+void PointRenderer::updateDefaultMarkers(QXYSeries *series,
+                                         PointGroup *group,
+                                         qsizetype firstMapped,
+                                         qsizetype removedFront)
+{
+    // Each marker is a border quad with the fill quad on top of it. Vertex colors are
+    // premultiplied, as expected by QSGVertexColorMaterial.
+    const auto style = getSeriesStyle(group);
+    const QRgb colors[3] = { style.color.rgba(),
+                             style.selectedColor.rgba(),
+                             style.borderColor.rgba() };
+    // Every marker is four border strips around one fill quad
+    constexpr qsizetype markerVertexCount = 5 * 4;
+    auto &vertices = group->markerVertices;
+    // Only the markers of newly mapped points need new vertices, unless the style changed
+    if (!std::equal(colors, colors + 3, group->markerColors)
+        || style.borderWidth != group->markerBorderWidth
+        || vertices.size() != (firstMapped + removedFront) * markerVertexCount) {
+        firstMapped = 0;
+        removedFront = 0;
+    } else if (removedFront == 0 && firstMapped == group->rects.size()) {
+        return;
+    }
+    std::copy(colors, colors + 3, group->markerColors);
+    group->markerBorderWidth = style.borderWidth;
+
+    auto premultiplied = [](QColor color) {
+        const int a = color.alpha();
+        return std::array<uchar, 4>{ uchar(color.red() * a / 255),
+                                     uchar(color.green() * a / 255),
+                                     uchar(color.blue() * a / 255),
+                                     uchar(a) };
+    };
+    const auto border = premultiplied(style.borderColor);
+    const auto fill = premultiplied(style.color);
+    const auto selectedFill = premultiplied(style.selectedColor);
+
+    vertices.remove(0, removedFront * markerVertexCount);
+    vertices.resize(group->rects.size() * markerVertexCount);
+    auto *v = vertices.data() + firstMapped * markerVertexCount;
+    auto setQuad = [&v](const QRectF &rect, const std::array<uchar, 4> &c) {
+        v[0].set(rect.left(), rect.top(), c[0], c[1], c[2], c[3]);
+        v[1].set(rect.right(), rect.top(), c[0], c[1], c[2], c[3]);
+        v[2].set(rect.left(), rect.bottom(), c[0], c[1], c[2], c[3]);
+        v[3].set(rect.right(), rect.bottom(), c[0], c[1], c[2], c[3]);
+        v += 4;
+    };
+
+    const qreal inset = qMin(style.borderWidth, defaultSize(series) / 2.0);
+    for (qsizetype i = firstMapped; i < group->rects.size(); ++i) {
+        const QRectF &rect = group->rects.at(i);
+        const QRectF fillRect = rect.adjusted(inset, inset, -inset, -inset);
+        // The border does not overlap the fill, so translucent colors do not mix
+        setQuad(QRectF(QPointF(rect.left(), rect.top()), QPointF(rect.right(), fillRect.top())),
+                border);
+        setQuad(QRectF(QPointF(rect.left(), fillRect.bottom()),
+                       QPointF(rect.right(), rect.bottom())),
+                border);
+        setQuad(QRectF(QPointF(rect.left(), fillRect.top()),
+                       QPointF(fillRect.left(), fillRect.bottom())),
+                border);
+        setQuad(QRectF(QPointF(fillRect.right(), fillRect.top()),
+                       QPointF(rect.right(), fillRect.bottom())),
+                border);
+        setQuad(fillRect, series->isPointSelected(i) ? selectedFill : fill);
+    }
+
+    group->markersDirty = true;
+    update();
+}
+
+void PointRenderer::dragPressedPoint(QPoint currentDelta)
+{
+    float w = width();
+    float h = height();
+    double maxVertical = m_graph->m_axisRenderer->m_axisVerticalValueRange > 0
+                             ? 1.0 / m_graph->m_axisRenderer->m_axisVerticalValueRange
+                             : 100.0;
+    double maxHorizontal = m_graph->m_axisRenderer->m_axisHorizontalValueRange > 0
+                               ? 1.0 / m_graph->m_axisRenderer->m_axisHorizontalValueRange
+                               : 100.0;
+
+    QPoint delta = currentDelta - m_previousDelta;
+    m_previousDelta = currentDelta;
+
+    qreal deltaX = delta.x() / w / maxHorizontal;
+    qreal deltaY = -delta.y() / h / maxVertical;
+
+    // Points may have been removed or evicted during the drag
+    if (m_pressedPointIndex >= m_pressedGroup->series->count())
+        return;
+    QPointF point = m_pressedGroup->series->at(m_pressedPointIndex) + QPointF(deltaX, deltaY);
+    m_pressedGroup->series->replace(m_pressedPointIndex, point);
 }
 
 void PointRenderer::updateLegendData(QXYSeries *series, QLegendData &legendData)
@@ -209,13 +738,10 @@ void PointRenderer::onSingleTapped(QEventPoint eventPoint, Qt::MouseButton butto
         if (!group->series->isSelectable() && !group->series->isDraggable())
             continue;
 
-        int index = 0;
-        for (auto &&rect : group->rects) {
-            if (rect.contains(eventPoint.position())) {
-                emit group->series->clicked(group->series->at(index).toPoint());
-                return;
-            }
-            index++;
+        const auto hits = pointsAt(group, eventPoint.position());
+        if (!hits.isEmpty()) {
+            emit group->series->clicked(group->series->at(hits.first()).toPoint());
+            return;
         }
     }
 }
@@ -231,13 +757,10 @@ void PointRenderer::onDoubleTapped(QEventPoint eventPoint, Qt::MouseButton butto
         if (!group->series->isSelectable() && !group->series->isDraggable())
             continue;
 
-        int index = 0;
-        for (auto &&rect : group->rects) {
-            if (rect.contains(eventPoint.position())) {
-                emit group->series->doubleClicked(group->series->at(index).toPoint());
-                return;
-            }
-            index++;
+        const auto hits = pointsAt(group, eventPoint.position());
+        if (!hits.isEmpty()) {
+            emit group->series->doubleClicked(group->series->at(hits.first()).toPoint());
+            return;
         }
     }
 }
@@ -245,6 +768,9 @@ void PointRenderer::onDoubleTapped(QEventPoint eventPoint, Qt::MouseButton butto
 void PointRenderer::onPressedChanged()
 {
     if (m_tapHandler->isPressed()) {
+        // A press that misses every marker must not leave an earlier point to be dragged
+        m_pressedGroup = nullptr;
+        m_pressCanceled = false;
         for (auto &&group : m_groups) {
             if (!group->series->isVisible())
                 continue;
@@ -252,22 +778,20 @@ void PointRenderer::onPressedChanged()
             if (!group->series->isSelectable() && !group->series->isDraggable())
                 continue;
 
-            int index = 0;
-            for (auto &&rect : group->rects) {
-                if (rect.contains(m_tapHandler->point().position())) {
-                    m_pressedGroup = group;
-                    m_pressedPointIndex = index;
-                    emit group->series->pressed(m_pressedGroup->series->at(index).toPoint());
-                }
-                index++;
+            const auto hits = pointsAt(group, m_tapHandler->point().position());
+            for (const qsizetype index : hits) {
+                m_pressedGroup = group;
+                m_pressedPointIndex = index;
+                emit group->series->pressed(m_pressedGroup->series->at(index).toPoint());
             }
         }
     } else {
         if (m_pressedGroup
             && m_pressedGroup->series->isSelectable()
-            && m_pressedGroup->series->isVisible()) {
+            && m_pressedGroup->series->isVisible()
+            && m_pressedPointIndex < m_pressedGroup->rects.size()) {
             if (m_pressedGroup->rects[m_pressedPointIndex].contains(
-                    m_tapHandler->point().position())) {
+                    m_tapHandler->point().position() - m_pressedGroup->translation)) {
                 if (m_pressedGroup->series->isPointSelected(m_pressedPointIndex))
                     m_pressedGroup->series->deselectPoint(m_pressedPointIndex);
                 else
@@ -277,7 +801,23 @@ void PointRenderer::onPressedChanged()
                     m_pressedGroup->series->at(m_pressedPointIndex).toPoint());
             }
         }
+        // When a drag took over, its handler releases the point when the drag ends
+        if (!m_pressCanceled)
+            m_pressedGroup = nullptr;
+    }
+}
+
+bool PointRenderer::hasDraggableMarkerAt(QPointF position)
+{
+    for (auto &&group : std::as_const(m_groups)) {
+        if (group->currentMarker || group->series->type() != QAbstractSeries::SeriesType::Scatter
+            || !group->series->isVisible() || !group->series->isDraggable()) {
+            continue;
+        }
+        if (!pointsAt(group, position).isEmpty())
+            return true;
     }
+    return false;
 }
 
 #ifdef USE_SCATTERGRAPH
@@ -287,19 +827,14 @@ void PointRenderer::updateScatterSeries(QScatterSeries *series, QLegendData &leg
     const auto style = getSeriesStyle(group);
 
     if (series->isVisible()) {
-        auto &&points = series->points();
-        group->rects.resize(points.size());
-        for (int i = 0; i < points.size(); ++i) {
-            qreal x, y;
-            calculateRenderCoordinates(m_graph->m_axisRenderer, points[i].x(), points[i].y(), &x, &y);
-            y *= series->valuesMultiplier();
-            if (group->currentMarker) {
-                updatePointDelegate(series, group, i, x, y);
-            } else {
-                auto &rect = group->rects[i];
-                qreal size = defaultSize(series);
-                rect = QRectF(x - size / 2.0, y - size / 2.0, size, size);
-            }
+        qsizetype removedFront = 0;
+        const qsizetype first = mapPoints(series, group, &removedFront);
+        if (group->currentMarker) {
+            const auto &renderPoints = group->renderPoints;
+            for (qsizetype i = 0; i < renderPoints.size(); ++i)
+                updatePointDelegate(series, group, i, renderPoints[i].x(), renderPoints[i].y());
+        } else {
+            updateDefaultMarkers(series, group, first, removedFront);
         }
     } else {
         hidePointDelegates(series);
@@ -314,46 +849,105 @@ void PointRenderer::updateLineSeries(QLineSeries *series, QLegendData &legendDat
 {
     auto group = m_groups.value(series);
     const auto style = getSeriesStyle(group);
-
-    group->shapePath->setStrokeColor(style.color);
-    group->shapePath->setStrokeWidth(series->width());
-    group->shapePath->setFillColor(QColorConstants::Transparent);
-
-    Qt::PenCapStyle capStyle = series->capStyle();
-    if (capStyle == Qt::PenCapStyle::SquareCap)
-        group->shapePath->setCapStyle(QQuickShapePath::CapStyle::SquareCap);
-    else if (capStyle == Qt::PenCapStyle::FlatCap)
-        group->shapePath->setCapStyle(QQuickShapePath::CapStyle::FlatCap);
-    else if (capStyle == Qt::PenCapStyle::RoundCap)
-        group->shapePath->setCapStyle(QQuickShapePath::CapStyle::RoundCap);
-
-    auto &painterPath = group->painterPath;
-    painterPath.clear();
+    auto &vertices = group->lineVertices;
 
     if (series->isVisible()) {
-        auto &&points = series->points();
-        group->rects.resize(points.size());
-        for (int i = 0; i < points.size(); ++i) {
-            qreal x, y;
-            calculateRenderCoordinates(m_graph->m_axisRenderer, points[i].x(), points[i].y(), &x, &y);
-            y *= series->valuesMultiplier();
-            if (i == 0)
-                painterPath.moveTo(x, y);
-            else
-                painterPath.lineTo(x, y);
-
-            if (group->currentMarker) {
-                updatePointDelegate(series, group, i, x, y);
+        qsizetype removedFront = 0;
+        const qsizetype first = mapPoints(series, group, &removedFront);
+        const auto &renderPoints = group->renderPoints;
+
+        const QRgb color = style.color.rgba();
+        const qreal width = series->width();
+        const Qt::PenCapStyle capStyle = series->capStyle();
+        const bool styleChanged = group->lineColor != color || group->lineWidth != width
+                                  || group->lineCapStyle != capStyle;
+
+        // A pan keeps the vertices as they are, appended points extend them and anything
+        // else rebuilds them
+        const bool unchanged = !styleChanged && removedFront == 0 && first > 0
+                               && first == renderPoints.size();
+        if (!unchanged) {
+            const bool decimate = series->decimationEnabled()
+                                  && shouldDecimate(renderPoints.size());
+            const QList<QPointF> points = decimate ? decimatePoints(renderPoints) : renderPoints;
+            const int a = style.color.alpha();
+            const LineColor lineColor = { uchar(style.color.red() * a / 255),
+                                          uchar(style.color.green() * a / 255),
+                                          uchar(style.color.blue() * a / 255),
+                                          uchar(a) };
+            const qreal halfWidth = width / 2.0;
+
+            auto &segmentCounts = group->lineSegmentVertexCounts;
+            if (!decimate && first > 1 && group->pathPointCount == first + removedFront
+                && !styleChanged) {
+                vertices.resize(vertices.size() - group->lineEndCapVertexCount);
+                if (removedFront > 0) {
+                    // Drop the start cap and the segments leaving the evicted points. The
+                    // first remaining drawn segment has a joint into an evicted one, so it
+                    // is drawn again behind a new start cap.
+                    qsizetype redraw = removedFront;
+                    while (redraw < segmentCounts.size() && segmentCounts[redraw] == 0)
+                        ++redraw;
+                    redraw = qMin(redraw + 1, segmentCounts.size());
+                    qsizetype dropped = group->lineStartCapVertexCount;
+                    for (qsizetype i = 0; i < redraw; ++i)
+                        dropped += segmentCounts[i];
+                    vertices.remove(0, dropped);
+                    segmentCounts.remove(0, redraw);
+
+                    QList<QSGGeometry::ColoredPoint2D> head;
+                    QList<qsizetype> headCounts;
+                    appendLineCap(head, points.first(), lineEndDirection(points, false),
+                                  halfWidth, capStyle, lineColor);
+                    group->lineStartCapVertexCount = head.size();
+                    appendLineSegments(head, headCounts, points.first(redraw - removedFront + 1),
+                                       0, halfWidth, lineColor);
+                    // Removing from the front leaves room there, so prepending is cheap
+                    for (auto it = head.crbegin(); it != head.crend(); ++it)
+                        vertices.prepend(*it);
+                    for (auto it = headCounts.crbegin(); it != headCounts.crend(); ++it)
+                        segmentCounts.prepend(*it);
+                }
+                appendLineSegments(vertices, segmentCounts, points, first - 1, halfWidth,
+                                   lineColor);
             } else {
-                auto &rect = group->rects[i];
-                qreal size = defaultSize(series);
-                rect = QRectF(x - size / 2.0, y - size / 2.0, size, size);
+                vertices.clear();
+                segmentCounts.clear();
+                if (points.size() > 1) {
+                    appendLineCap(vertices, points.first(), lineEndDirection(points, false),
+                                  halfWidth, capStyle, lineColor);
+                }
+                group->lineStartCapVertexCount = vertices.size();
+                appendLineSegments(vertices, segmentCounts, points, 0, halfWidth, lineColor);
+            }
+            const qsizetype endCapStart = vertices.size();
+            if (points.size() > 1) {
+                appendLineCap(vertices, points.last(), lineEndDirection(points, true),
+                              halfWidth, capStyle, lineColor);
             }
+            group->lineEndCapVertexCount = vertices.size() - endCapStart;
+            group->pathPointCount = decimate ? -1 : renderPoints.size();
+            group->lineColor = color;
+            group->lineWidth = width;
+            group->lineCapStyle = capStyle;
+            group->lineDirty = true;
+            update();
+        }
+
+        if (group->currentMarker) {
+            for (qsizetype i = 0; i < renderPoints.size(); ++i)
+                updatePointDelegate(series, group, i, renderPoints[i].x(), renderPoints[i].y());
         }
     } else {
+        if (!vertices.isEmpty()) {
+            vertices.clear();
+            group->lineSegmentVertexCounts.clear();
+            group->lineDirty = true;
+            update();
+        }
+        group->pathPointCount = -1;
         hidePointDelegates(series);
     }
-    group->shapePath->setPath(painterPath);
     legendData = { style.color, style.borderColor, series->name() };
 }
 #endif
@@ -378,47 +972,49 @@ void PointRenderer::updateSplineSeries(QSplineSeries *series, QLegendData &legen
 
     auto &painterPath = group->painterPath;
     painterPath.clear();
+    group->hitIndexDirty = true;
 
     if (series->isVisible()) {
-        auto &&points = series->points();
-        group->rects.resize(points.size());
-        auto fittedPoints = series->getControlPoints();
-
-        for (int i = 0, j = 0; i < points.size(); ++i, ++j) {
-            qreal x, y;
-            calculateRenderCoordinates(m_graph->m_axisRenderer, points[i].x(), points[i].y(), &x, &y);
-
-            qreal valuesMultiplier = series->valuesMultiplier();
-            y *= valuesMultiplier;
-            if (i == 0) {
-                painterPath.moveTo(x, y);
-            } else {
-                qreal x1, y1, x2, y2;
-                calculateRenderCoordinates(m_graph->m_axisRenderer,
-                                           fittedPoints[j - 1].x(),
-                                           fittedPoints[j - 1].y(),
-                                           &x1,
-                                           &y1);
-                calculateRenderCoordinates(m_graph->m_axisRenderer,
-                                           fittedPoints[j].x(),
-                                           fittedPoints[j].y(),
-                                           &x2,
-                                           &y2);
-
-                y1 *= valuesMultiplier;
-                y2 *= valuesMultiplier;
-                painterPath.cubicTo(x1, y1, x2, y2, x, y);
-                ++j;
-            }
+        qsizetype removedFront = 0;
+        mapPoints(series, group, &removedFront);
+        const auto &renderPoints = group->renderPoints;
+        // A decimated spline is drawn as a polyline, the curvature would be sub-pixel anyway
+        const bool decimate = series->decimationEnabled() && shouldDecimate(renderPoints.size());
+
+        if (decimate) {
+            appendDecimatedPath(painterPath, renderPoints);
+        } else {
+            auto fittedPoints = series->getControlPoints();
+            const qreal valuesMultiplier = series->valuesMultiplier();
 
-            if (group->currentMarker) {
-                updatePointDelegate(series, group, i, x, y);
-            } else {
-                auto &rect = group->rects[i];
-                qreal size = defaultSize(series);
-                rect = QRectF(x - size / 2.0, y - size / 2.0, size, size);
+            for (qsizetype i = 0, j = 0; i < renderPoints.size(); ++i, ++j) {
+                if (i == 0) {
+                    painterPath.moveTo(renderPoints[i]);
+                } else {
+                    qreal x1, y1, x2, y2;
+                    calculateRenderCoordinates(m_graph->m_axisRenderer,
+                                               fittedPoints[j - 1].x(),
+                                               fittedPoints[j - 1].y(),
+                                               &x1,
+                                               &y1);
+                    calculateRenderCoordinates(m_graph->m_axisRenderer,
+                                               fittedPoints[j].x(),
+                                               fittedPoints[j].y(),
+                                               &x2,
+                                               &y2);
+
+                    y1 *= valuesMultiplier;
+                    y2 *= valuesMultiplier;
+                    painterPath.cubicTo(QPointF(x1, y1), QPointF(x2, y2), renderPoints[i]);
+                    ++j;
+                }
             }
         }
+
+        if (group->currentMarker) {
+            for (qsizetype i = 0; i < renderPoints.size(); ++i)
+                updatePointDelegate(series, group, i, renderPoints[i].x(), renderPoints[i].y());
+        }
     } else {
         hidePointDelegates(series);
     }
@@ -446,11 +1042,26 @@ void PointRenderer::handlePolish(QXYSeries *series)
                 painterPath.clear();
                 group->shapePath->setPath(painterPath);
             }
+            group->pathPointCount = -1;
+
+            if (!group->lineVertices.isEmpty()) {
+                group->lineVertices.clear();
+                group->lineDirty = true;
+                update();
+            }
 
             for (auto m : group->markers)
                 m->deleteLater();
 
             group->markers.clear();
+            group->rects.clear();
+            group->hitIndexDirty = true;
+
+            if (!group->markerVertices.isEmpty()) {
+                group->markerVertices.clear();
+                group->markersDirty = true;
+                update();
+            }
         }
 
         return;
@@ -488,7 +1099,7 @@ void PointRenderer::handlePolish(QXYSeries *series)
         group->series = series;
         m_groups.insert(series, group);
 
-        if (series->type() != QAbstractSeries::SeriesType::Scatter) {
+        if (series->type() == QAbstractSeries::SeriesType::Spline) {
             group->shapePath = new QQuickShapePath(&m_shape);
             group->shapePath->setAsynchronous(true);
             auto data = m_shape.data();
@@ -500,15 +1111,14 @@ void PointRenderer::handlePolish(QXYSeries *series)
 
     qsizetype pointCount = series->points().size();
 
-    if ((series->type() == QAbstractSeries::SeriesType::Scatter) && !series->pointDelegate())
-        group->currentMarker = m_tempMarker;
-    else if (series->pointDelegate())
-        group->currentMarker = series->pointDelegate();
+    // Scatter series without a delegate draw their markers in updatePaintNode()
+    group->currentMarker = series->pointDelegate();
 
     if (group->currentMarker != group->previousMarker) {
         for (auto &&marker : group->markers)
             marker->deleteLater();
         group->markers.clear();
+        group->dragHandlers.clear();
     }
     group->previousMarker = group->currentMarker;
 
@@ -529,30 +1139,11 @@ void PointRenderer::handlePolish(QXYSeries *series)
                 group->dragHandlers << handler;
 
                 connect(handler, &QQuickDragHandler::translationChanged, this, [&]() {
-                    if (m_pressedGroup) {
-                        float w = width();
-                        float h = height();
-                        double maxVertical
-                            = m_graph->m_axisRenderer->m_axisVerticalValueRange > 0
-                                  ? 1.0 / m_graph->m_axisRenderer->m_axisVerticalValueRange
-                                  : 100.0;
-                        double maxHorizontal
-                            = m_graph->m_axisRenderer->m_axisHorizontalValueRange > 0
-                                  ? 1.0 / m_graph->m_axisRenderer->m_axisHorizontalValueRange
-                                  : 100.0;
-
-                        QPoint currentDelta =
-                            m_pressedGroup->dragHandlers.at(m_pressedPointIndex)
-                                ->activeTranslation().toPoint();
-                        QPoint delta = currentDelta - m_previousDelta;
-                        m_previousDelta = currentDelta;
-
-                        qreal deltaX = delta.x() / w / maxHorizontal;
-                        qreal deltaY = -delta.y() / h / maxVertical;
-
-                        QPointF point = m_pressedGroup->series->at(m_pressedPointIndex)
-                                        + QPointF(deltaX, deltaY);
-                        m_pressedGroup->series->replace(m_pressedPointIndex, point);
+                    if (m_pressedGroup && m_pressedGroup->currentMarker
+                        && m_pressedPointIndex < m_pressedGroup->dragHandlers.size()) {
+                        dragPressedPoint(m_pressedGroup->dragHandlers.at(m_pressedPointIndex)
+                                             ->activeTranslation()
+                                             .toPoint());
                     }
                 });
                 connect(handler, &QQuickDragHandler::grabChanged, this,
@@ -562,6 +1153,7 @@ void PointRenderer::handlePolish(QXYSeries *series)
                             if (transition == QPointingDevice::UngrabExclusive ||
                                 transition == QPointingDevice::UngrabPassive) {
                                 m_previousDelta = QPoint(0, 0);
+                                m_pressedGroup = nullptr;
                             }
                         });
             }
@@ -569,11 +1161,19 @@ void PointRenderer::handlePolish(QXYSeries *series)
             for (qsizetype i = pointCount; i < markerCount; ++i)
                 group->markers[i]->deleteLater();
             group->markers.resize(pointCount);
+            group->dragHandlers.resize(pointCount);
         }
     } else if (group->markers.size() > 0) {
         for (auto &&marker : group->markers)
             marker->deleteLater();
         group->markers.clear();
+        group->dragHandlers.clear();
+    }
+
+    if (group->currentMarker && !group->markerVertices.isEmpty()) {
+        group->markerVertices.clear();
+        group->markersDirty = true;
+        update();
     }
 
     if (group->colorIndex < 0) {
@@ -620,10 +1220,143 @@ void PointRenderer::afterPolish(QList<QAbstractSeries *> &cleanupSeries)
                 group->shapePath->setPath(painterPath);
             }
 
+            if (group->markerTransformNode) {
+                m_removedNodes << group->markerTransformNode;
+                update();
+            }
+            if (group->lineTransformNode) {
+                m_removedNodes << group->lineTransformNode;
+                update();
+            }
+
+            if (m_pressedGroup == group)
+                m_pressedGroup = nullptr;
+
             delete group;
             m_groups.remove(xySeries);
         }
     }
+
+    bool defaultMarkersDraggable = false;
+    for (auto &&group : std::as_const(m_groups)) {
+        if (!group->currentMarker && group->series->type() == QAbstractSeries::SeriesType::Scatter
+            && group->series->isDraggable() && group->series->isVisible()) {
+            defaultMarkersDraggable = true;
+            break;
+        }
+    }
+    m_dragHandler->setEnabled(defaultMarkersDraggable);
+}
+
+// Creates a node drawing quads of colored vertices
+static QSGGeometryNode *createQuadNode()
+{
+    auto node = new QSGGeometryNode();
+    auto geometry = new QSGGeometry(QSGGeometry::defaultAttributes_ColoredPoint2D(),
+                                    0,
+                                    0,
+                                    QSGGeometry::UnsignedIntType);
+    geometry->setDrawingMode(QSGGeometry::DrawTriangles);
+    node->setGeometry(geometry);
+    node->setFlag(QSGNode::OwnsGeometry);
+    node->setMaterial(new QSGVertexColorMaterial());
+    node->setFlag(QSGNode::OwnsMaterial);
+    return node;
+}
+
+// Places a quad node under a transform node carrying the pan translation of its group
+static QSGTransformNode *createTransformNode(QSGGeometryNode *child)
+{
+    auto node = new QSGTransformNode();
+    node->appendChildNode(child);
+    return node;
+}
+
+static void setTranslation(QSGTransformNode *node, QPointF translation)
+{
+    QMatrix4x4 matrix;
+    matrix.translate(translation.x(), translation.y());
+    if (node->matrix() != matrix)
+        node->setMatrix(matrix);
+}
+
+static void uploadQuads(QSGGeometryNode *node,
+                        const QList<QSGGeometry::ColoredPoint2D> &vertices)
+{
+    const qsizetype quadCount = vertices.size() / 4;
+    auto geometry = node->geometry();
+    geometry->allocate(vertices.size(), quadCount * 6);
+    if (!vertices.isEmpty()) {
+        memcpy(geometry->vertexDataAsColoredPoint2D(),
+               vertices.constData(),
+               vertices.size() * sizeof(QSGGeometry::ColoredPoint2D));
+    }
+    quint32 *indices = geometry->indexDataAsUInt();
+    for (qsizetype i = 0; i < quadCount; ++i) {
+        const quint32 first = quint32(i * 4);
+        *indices++ = first;
+        *indices++ = first + 1;
+        *indices++ = first + 2;
+        *indices++ = first + 2;
+        *indices++ = first + 1;
+        *indices++ = first + 3;
+    }
+    node->markDirty(QSGNode::DirtyGeometry);
+}
+
+QSGNode *PointRenderer::updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData)
+{
+    Q_UNUSED(updatePaintNodeData);
+
+    QSGNode *root = oldNode;
+    if (!root) {
+        // Any earlier nodes went away with the previous root
+        root = new QSGNode();
+        m_removedNodes.clear();
+        for (auto &&group : std::as_const(m_groups)) {
+            group->markerTransformNode = nullptr;
+            group->markerNode = nullptr;
+            group->markersDirty = !group->markerVertices.isEmpty();
+            group->lineTransformNode = nullptr;
+            group->lineNode = nullptr;
+            group->lineDirty = !group->lineVertices.isEmpty();
+        }
+    }
+
+    for (auto node : std::as_const(m_removedNodes)) {
+        root->removeChildNode(node);
+        delete node;
+    }
+    m_removedNodes.clear();
+
+    for (auto &&group : std::as_const(m_groups)) {
+        if (group->lineDirty) {
+            group->lineDirty = false;
+            if (!group->lineNode) {
+                // Lines stay below all the markers
+                group->lineNode = createQuadNode();
+                group->lineTransformNode = createTransformNode(group->lineNode);
+                root->prependChildNode(group->lineTransformNode);
+            }
+            uploadQuads(group->lineNode, group->lineVertices);
+        }
+        if (group->lineTransformNode)
+            setTranslation(group->lineTransformNode, group->translation);
+
+        if (group->markersDirty) {
+            group->markersDirty = false;
+            if (!group->markerNode) {
+                group->markerNode = createQuadNode();
+                group->markerTransformNode = createTransformNode(group->markerNode);
+                root->appendChildNode(group->markerTransformNode);
+            }
+            uploadQuads(group->markerNode, group->markerVertices);
+        }
+        if (group->markerTransformNode)
+            setTranslation(group->markerTransformNode, group->translation);
+    }
+
+    return root;
 }
 
 void PointRenderer::updateSeries(QXYSeries *series)
@@ -656,17 +1389,14 @@ bool PointRenderer::handleHoverMove(QHoverEvent *event)
 
             bool hovering = false;
 
-            int index = 0;
-            for (auto &&rect : group->rects) {
-                if (rect.contains(position.toPoint())) {
-                    if (!group->hover) {
-                        group->hover = true;
-                        emit group->series->hoverEnter(name, position, group->series->at(index));
-                    }
-                    emit group->series->hover(name, position, group->series->at(index));
-                    hovering = true;
+            const auto hits = pointsAt(group, position.toPoint());
+            for (const qsizetype index : hits) {
+                if (!group->hover) {
+                    group->hover = true;
+                    emit group->series->hoverEnter(name, position, group->series->at(index));
                 }
-                index++;
+                emit group->series->hover(name, position, group->series->at(index));
+                hovering = true;
             }
 
             if (!hovering && group->hover) {
@@ -674,56 +1404,51 @@ bool PointRenderer::handleHoverMove(QHoverEvent *event)
                 emit group->series->hoverExit(name, position);
             }
         } else {
-            const qreal x0 = event->position().x();
-            const qreal y0 = event->position().y();
+            const qreal x0 = event->position().x() - group->translation.x();
+            const qreal y0 = event->position().y() - group->translation.y();
 
             const qreal hoverSize = defaultSize(group->series) / 2.0;
             const QString &name = group->series->name();
             auto &&points = group->series->points();
             // True when line, false when spline
             const bool isLine = group->series->type() == QAbstractSeries::SeriesType::Line;
-            if (points.size() >= 2) {
+            if (points.size() >= 2 && group->renderPoints.size() == points.size()) {
                 bool hovering = false;
-                auto subpath = group->painterPath.toSubpathPolygons();
-
-                for (int i = 0; i < points.size() - 1; i++) {
-                    qreal x1, y1, x2, y2;
-                    if (i == 0) {
-                        auto element1 = group->painterPath.elementAt(0);
-                        auto element2 = group->painterPath.elementAt(isLine ? 1 : 3);
-                        x1 = isHNegative ? element2.x : element1.x;
-                        y1 = element1.y;
-                        x2 = isHNegative ? element1.x : element2.x;
-                        y2 = element2.y;
-                    } else {
-                        bool n = isVNegative | isHNegative;
-                        // Each Spline (cubicTo) has 3 elements where third one is the x & y.
-                        // So content of elements are:
-                        // With Spline:
-                        // [0] : MoveToElement
-                        // [1] : 1. CurveToElement (c1x, c1y)
-                        // [2] : 1. CurveToDataElement (c2x, c2y)
-                        // [3] : 1. CurveToDataElement (x, y)
-                        // [4] : 2. CurveToElement (c1x, c1y)
-                        // ...
-                        // With Line:
-                        // [0] : MoveToElement
-                        // [1] : 1. LineToElement (x, y)
-                        // [2] : 2. LineToElement (x, y)
-                        // ...
-                        int element1Index = n ? (i + 1) : i;
-                        int element2Index = n ? i : (i + 1);
-                        element1Index = isLine ? element1Index : element1Index * 3;
-                        element2Index = isLine ? element2Index : element2Index * 3;
-                        auto element1 = group->painterPath.elementAt(element1Index);
-                        auto element2 = group->painterPath.elementAt(element2Index);
-                        x1 = element1.x;
-                        y1 = element1.y;
-                        x2 = element2.x;
-                        y2 = element2.y;
-                    }
+                updateHitIndex(group);
+
+                // Only the segments around the cursor are tested
+                const auto &renderPoints = group->renderPoints;
+                const QList<QPointF> &segments
+                    = isLine ? renderPoints
+                             : static_cast<const QList<QPointF> &>(group->hoverPolygon);
+                qsizetype first, last;
+                segmentRange(segments,
+                             group->xOrder,
+                             x0 - hoverSize,
+                             x0 + hoverSize,
+                             &first,
+                             &last);
+
+                if (isLine) {
+                    for (qsizetype i = first; i < last; i++) {
+                        qreal x1, y1, x2, y2;
+                        if (i == 0) {
+                            const QPointF &element1 = renderPoints[0];
+                            const QPointF &element2 = renderPoints[1];
+                            x1 = isHNegative ? element2.x() : element1.x();
+                            y1 = element1.y();
+                            x2 = isHNegative ? element1.x() : element2.x();
+                            y2 = element2.y();
+                        } else {
+                            bool n = isVNegative | isHNegative;
+                            const QPointF &element1 = renderPoints[n ? (i + 1) : i];
+                            const QPointF &element2 = renderPoints[n ? i : (i + 1)];
+                            x1 = element1.x();
+                            y1 = element1.y();
+                            x2 = element2.x();
+                            y2 = element2.y();
+                        }
 
-                    if (isLine) {
                         qreal denominator = (x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1);
                         qreal hoverDistance = qAbs((x2 - x1) * (y1 - y0) - (x1 - x0) * (y2 - y1))
                                               / qSqrt(denominator);
@@ -762,66 +1487,62 @@ bool PointRenderer::handleHoverMove(QHoverEvent *event)
                                 handled = true;
                             }
                         }
-                    } else { // Spline
-                        auto segments = subpath[0];
-
-                        for (auto it = segments.begin(); it != segments.end(); ++it) {
-                            if (std::next(it, 1) == segments.end())
-                                break;
-
-                            auto it2 = std::next(it, 1);
-
-                            qreal denominator = (it2->x() - it->x()) * (it2->x() - it->x())
-                                                + (it2->y() - it->y()) * (it2->y() - it->y());
-                            qreal hoverDistance = qAbs((it2->x() - it->x()) * (it->y() - y0)
-                                                       - (it->x() - x0) * (it2->y() - it->y()))
-                                                  / qSqrt(denominator);
-
-                            if (hoverDistance < hoverSize) {
-                                qreal alpha = 0;
-                                qreal extrapolation = 0;
-                                if (it2->x() - it->x() >= it2->y() - it->y()) {
-                                    if (it2->x() - it->x() != 0) {
-                                        alpha = ((it2->x() - it->x()) - (x0 - it->x()))
-                                                / qAbs(it2->x() - it->x());
-                                        extrapolation = hoverSize / qAbs(it2->x() - it->x());
-                                    }
-                                } else {
-                                    if (it2->y() - it->y() != 0) {
-                                        alpha = ((it2->y() - it->y()) - (y0 - it->y()))
-                                                / qAbs(it2->y() - it->y());
-                                        extrapolation = hoverSize / qAbs(it2->y() - it->y());
-                                    }
+                    }
+                } else { // Spline
+                    for (qsizetype i = first; i < last; i++) {
+                        auto it = segments.begin() + i;
+                        auto it2 = std::next(it, 1);
+
+                        qreal denominator = (it2->x() - it->x()) * (it2->x() - it->x())
+                                            + (it2->y() - it->y()) * (it2->y() - it->y());
+                        qreal hoverDistance = qAbs((it2->x() - it->x()) * (it->y() - y0)
+                                                   - (it->x() - x0) * (it2->y() - it->y()))
+                                              / qSqrt(denominator);
+
+                        if (hoverDistance < hoverSize) {
+                            qreal alpha = 0;
+                            qreal extrapolation = 0;
+                            if (it2->x() - it->x() >= it2->y() - it->y()) {
+                                if (it2->x() - it->x() != 0) {
+                                    alpha = ((it2->x() - it->x()) - (x0 - it->x()))
+                                            / qAbs(it2->x() - it->x());
+                                    extrapolation = hoverSize / qAbs(it2->x() - it->x());
+                                }
+                            } else {
+                                if (it2->y() - it->y() != 0) {
+                                    alpha = ((it2->y() - it->y()) - (y0 - it->y()))
+                                            / qAbs(it2->y() - it->y());
+                                    extrapolation = hoverSize / qAbs(it2->y() - it->y());
                                 }
+                            }
+
+                            if (alpha >= -extrapolation && alpha <= 1.0 + extrapolation) {
+                                qreal cx1, cy1, cx2, cy2;
+
+                                reverseRenderCoordinates(axisRenderer,
+                                                         it->x(),
+                                                         it->y(),
+                                                         &cx1,
+                                                         &cy1);
+                                reverseRenderCoordinates(axisRenderer,
+                                                         it2->x(),
+                                                         it2->y(),
+                                                         &cx2,
+                                                         &cy2);
+
+                                const QPointF &point1 = {cx1, cy1};
+                                const QPointF &point2 = {cx2, cy2};
 
-                                if (alpha >= -extrapolation && alpha <= 1.0 + extrapolation) {
-                                    qreal cx1, cy1, cx2, cy2;
-
-                                    reverseRenderCoordinates(axisRenderer,
-                                                             it->x(),
-                                                             it->y(),
-                                                             &cx1,
-                                                             &cy1);
-                                    reverseRenderCoordinates(axisRenderer,
-                                                             it2->x(),
-                                                             it2->y(),
-                                                             &cx2,
-                                                             &cy2);
-
-                                    const QPointF &point1 = {cx1, cy1};
-                                    const QPointF &point2 = {cx2, cy2};
-
-                                    QPointF point = (point2 * (1.0 - alpha)) + (point1 * alpha);
-
-                                    if (!group->hover) {
-                                        group->hover = true;
-                                        emit group->series->hoverEnter(name, position, point);
-                                    }
-
-                                    emit group->series->hover(name, position, point);
-                                    hovering = true;
-                                    handled = true;
+                                QPointF point = (point2 * (1.0 - alpha)) + (point1 * alpha);
+
+                                if (!group->hover) {
+                                    group->hover = true;
+                                    emit group->series->hoverEnter(name, position, point);
                                 }
+
+                                emit group->series->hover(name, position, point);
+                                hovering = true;
+                                handled = true;
                             }
                         }
                     }
@@ -17,8 +17,12 @@
 #include <QQuickItem>
 #include <QtGraphs/qabstractseries.h>
 #include <QtQuick/private/qsgdefaultinternalrectanglenode_p.h>
+#include <QtQuick/qsggeometry.h>
 #include <QtQuickShapes/private/qquickshape_p.h>
 #include <QPainterPath>
+#include <QPolygonF>
+
+#include <array>
 
 QT_BEGIN_NAMESPACE
 
@@ -30,6 +34,8 @@ class QSplineSeries;
 class AxisRenderer;
 class QQuickTapHandler;
 class QQuickDragHandler;
+class QSGGeometryNode;
+class QSGTransformNode;
 struct QLegendData;
 
 class PointRenderer : public QQuickItem
@@ -44,23 +50,73 @@ public:
     void updateSeries(QXYSeries *series);
     void afterUpdate(QList<QAbstractSeries *> &cleanupSeries);
     bool handleHoverMove(QHoverEvent *event);
+    bool hasDraggableMarkerAt(QPointF position);
+
+protected:
+    QSGNode *updatePaintNode(QSGNode *oldNode, UpdatePaintNodeData *updatePaintNodeData) override;
 
 private:
     struct PointGroup
     {
         QXYSeries *series = nullptr;
+        // Splines are drawn with a shape path
         QQuickShapePath *shapePath = nullptr;
         QPainterPath painterPath;
+        // Render coordinates of all points, reused for unchanged points when streaming
+        QList<QPointF> renderPoints;
+        std::array<qreal, 6> mappingState = {};
+        // Axis offsets the points were mapped with. Panning only changes the offsets,
+        // so instead of mapping the points again the nodes, delegates and hit tests
+        // apply the translation to the current offsets.
+        QPointF mappedOffset;
+        QPointF translation;
+        // Number of points in painterPath or lineVertices, or -1 when it was not built
+        // point by point
+        qsizetype pathPointCount = -1;
+        // Line series are expanded into quads and drawn in a single node. The start cap
+        // leads the vertices and the end cap trails them. The vertex count of each segment
+        // is kept, so that the segments of points evicted from the front can be dropped.
+        QList<QSGGeometry::ColoredPoint2D> lineVertices;
+        QList<qsizetype> lineSegmentVertexCounts;
+        qsizetype lineStartCapVertexCount = 0;
+        QSGTransformNode *lineTransformNode = nullptr;
+        QSGGeometryNode *lineNode = nullptr;
+        QRgb lineColor = 0;
+        qreal lineWidth = -1;
+        Qt::PenCapStyle lineCapStyle = Qt::SquareCap;
+        qsizetype lineEndCapVertexCount = 0;
+        bool lineDirty = false;
         QList<QQuickItem *> markers;
         QList<QQuickDragHandler *> dragHandlers;
         QQmlComponent *currentMarker = nullptr;
         QQmlComponent *previousMarker = nullptr;
         QList<QRectF> rects;
+        // Default markers, drawn in a single node when there is no delegate
+        QList<QSGGeometry::ColoredPoint2D> markerVertices;
+        QSGTransformNode *markerTransformNode = nullptr;
+        QSGGeometryNode *markerNode = nullptr;
+        QRgb markerColors[3] = {};
+        qreal markerBorderWidth = -1;
+        bool markersDirty = false;
+        // Hit testing index, built on the first query after a polish. The rects are
+        // bucketed by their center into a uniform grid, and the segments of the rendered
+        // line can be binary searched when its x coordinates are ordered.
+        QList<qsizetype> gridCellStart;
+        QList<qsizetype> gridIndices;
+        QPointF gridOrigin;
+        qreal gridCellSize = 1;
+        qsizetype gridColumns = 0;
+        qsizetype gridRows = 0;
+        // Flattened spline path used for hover
+        QPolygonF hoverPolygon;
+        // 1 when the x coordinates of the rendered line ascend, -1 when they descend
+        int xOrder = 0;
+        bool hitIndexDirty = true;
         qsizetype colorIndex = -1;
         bool hover = false;
     };
 
-    QQmlComponent *m_tempMarker = nullptr;
+    QList<QSGNode *> m_removedNodes;
 
     QGraphsView *m_graph = nullptr;
     QQuickShape m_shape;
@@ -71,6 +127,8 @@ private:
     QPoint m_previousDelta;
     PointGroup *m_pressedGroup = nullptr;
     qsizetype m_pressedPointIndex = 0;
+    bool m_pressCanceled = false;
+    QQuickDragHandler *m_dragHandler = nullptr;
 
     // Render area variables
     qreal m_maxVertical = 0;
@@ -97,9 +155,18 @@ private:
         AxisRenderer *axisRenderer, qreal origX, qreal origY, qreal *renderX, qreal *renderY);
     void reverseRenderCoordinates(
         AxisRenderer *axisRenderer, qreal renderX, qreal renderY, qreal *origX, qreal *origY);
+    bool shouldDecimate(qsizetype pointCount) const;
+    qsizetype mapPoints(QXYSeries *series, PointGroup *group, qsizetype *removedFront);
     void updatePointDelegate(
         QXYSeries *series, PointGroup *group, qsizetype pointIndex, qreal x, qreal y);
     void hidePointDelegates(QXYSeries *series);
+    void updateHitIndex(PointGroup *group);
+    QList<qsizetype> pointsAt(PointGroup *group, QPointF position);
+    void updateDefaultMarkers(QXYSeries *series,
+                              PointGroup *group,
+                              qsizetype firstMapped = 0,
+                              qsizetype removedFront = 0);
+    void dragPressedPoint(QPoint currentDelta);
     void updateLegendData(QXYSeries *series, QLegendData &legendData);
 
     void onSingleTapped(QEventPoint eventPoint, Qt::MouseButton button);
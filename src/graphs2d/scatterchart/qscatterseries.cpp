@@ -95,6 +95,10 @@ QT_BEGIN_NAMESPACE
     \qmlproperty Component ScatterSeries::pointDelegate
     Marks points with the given QML component.
 
+    When no delegate is set, the points are drawn as plain markers which are
+    batched into a single draw call for the whole series. Setting a delegate
+    creates one item per point, which is considerably slower for large series.
+
     \code
         pointDelegate: Image {
             source: "images/happy_box.png"
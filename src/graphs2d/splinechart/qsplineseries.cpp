@@ -46,6 +46,30 @@ QT_BEGIN_NAMESPACE
     \sa Qt::PenCapStyle
 */
 
+/*!
+    \property QSplineSeries::decimationEnabled
+    \brief Controls whether the spline is decimated before drawing.
+    \since 6.10
+
+    When enabled and the series has more points than can be distinguished on
+    screen, only the first, last, minimum and maximum point of each pixel column
+    are drawn. This preserves the visual envelope of the spline while drawing
+    only a number of segments proportional to the plot width. While decimating, the
+    points are connected with straight lines instead of spline segments, as the
+    curvature would not be visible at that density anyway.
+    By default, decimationEnabled is set to \c false.
+*/
+/*!
+    \qmlproperty bool SplineSeries::decimationEnabled
+    \since 6.10
+    Controls whether the spline is decimated before drawing. When enabled and
+    the series has more points than can be distinguished on screen, only the
+    first, last, minimum and maximum point of each pixel column are drawn. While decimating, the
+    points are connected with straight lines instead of spline segments, as the
+    curvature would not be visible at that density anyway.
+    By default, decimationEnabled is set to \c false.
+*/
+
 /*!
     \qmlsignal SplineSeries::widthChanged()
     This signal is emitted when the spline series width changes.
@@ -56,6 +80,12 @@ QT_BEGIN_NAMESPACE
     This signal is emitted when the spline series cap style changes.
 */
 
+/*!
+    \qmlsignal SplineSeries::decimationEnabledChanged()
+    \since 6.10
+    This signal is emitted when the spline series decimation changes.
+*/
+
 QSplineSeries::QSplineSeries(QObject *parent)
     : QXYSeries(*(new QSplineSeriesPrivate()), parent)
 {}
@@ -80,21 +110,36 @@ void QSplineSeries::componentComplete()
     if (d->m_graphTransition)
         d->m_graphTransition->initialize();
 
-    connect(this, &QSplineSeries::pointAdded, this, [d]([[maybe_unused]] int index) {
-        d->calculateSplinePoints();
+    connect(this, &QSplineSeries::pointAdded, this, [this, d](qsizetype index) {
+        if (index == count() - 1)
+            d->pointsAppended(1);
+        else
+            d->calculateSplinePoints();
+    });
+
+    connect(this, &QSplineSeries::pointsAdded, this, [this, d](qsizetype start, qsizetype end) {
+        if (end == count() - 1)
+            d->pointsAppended(end - start + 1);
+        else
+            d->calculateSplinePoints();
     });
 
-    connect(this, &QSplineSeries::pointRemoved, this, [d]([[maybe_unused]] int index) {
-        d->calculateSplinePoints();
+    connect(this, &QSplineSeries::pointRemoved, this, [d](qsizetype index) {
+        if (index == 0)
+            d->pointsRemovedFromFront(1);
+        else
+            d->calculateSplinePoints();
     });
 
-    connect(this, &QSplineSeries::pointsRemoved, this
-            , [d]([[maybe_unused]] int index, [[maybe_unused]] int count) {
-       d->calculateSplinePoints();
-   });
+    connect(this, &QSplineSeries::pointsRemoved, this, [d](qsizetype index, qsizetype count) {
+        if (index == 0)
+            d->pointsRemovedFromFront(count);
+        else
+            d->calculateSplinePoints();
+    });
 
-    connect(this, &QSplineSeries::pointReplaced, this, [d]([[maybe_unused]] int index) {
-        d->calculateSplinePoints();
+    connect(this, &QSplineSeries::pointReplaced, this, [d](qsizetype index) {
+        d->pointReplaced(index);
     });
 
     connect(this, &QSplineSeries::pointsReplaced, this, [d]() { d->calculateSplinePoints(); });
@@ -149,6 +194,22 @@ void QSplineSeries::setCapStyle(Qt::PenCapStyle newCapStyle)
     emit update();
 }
 
+bool QSplineSeries::decimationEnabled() const
+{
+    Q_D(const QSplineSeries);
+    return d->m_decimationEnabled;
+}
+
+void QSplineSeries::setDecimationEnabled(bool enabled)
+{
+    Q_D(QSplineSeries);
+    if (d->m_decimationEnabled == enabled)
+        return;
+    d->m_decimationEnabled = enabled;
+    emit decimationEnabledChanged();
+    emit update();
+}
+
 QSplineSeriesPrivate::QSplineSeriesPrivate()
     : QXYSeriesPrivate()
     , m_width(1.0)
@@ -231,6 +292,100 @@ void QSplineSeriesPrivate::calculateSplinePoints()
     m_controlPoints = controlPoints;
 }
 
+// A change in the points affects the control points of the neighbouring segments by a
+// factor of 2 - sqrt(3) per segment, so beyond this many segments the change is below
+// floating point precision and the previous solution can be kept.
+static constexpr qsizetype splineSolveMargin = 32;
+
+void QSplineSeriesPrivate::pointsAppended(qsizetype count)
+{
+    const qsizetype n = m_points.size() - 1;
+    const qsizetype oldN = n - count;
+    // The previous last segment used the end boundary equation, so it is solved again
+    const qsizetype first = oldN - 1 - splineSolveMargin;
+    if (first <= 0 || n <= 2 * splineSolveMargin || m_controlPoints.size() != oldN * 2) {
+        calculateSplinePoints();
+        return;
+    }
+
+    m_controlPoints.resize(n * 2);
+    solveControlPoints(first, n);
+}
+
+void QSplineSeriesPrivate::pointsRemovedFromFront(qsizetype count)
+{
+    const qsizetype n = m_points.size() - 1;
+    const qsizetype oldN = n + count;
+    if (n <= 2 * splineSolveMargin || m_controlPoints.size() != oldN * 2) {
+        calculateSplinePoints();
+        return;
+    }
+
+    m_controlPoints.remove(0, count * 2);
+    solveControlPoints(0, splineSolveMargin);
+}
+
+void QSplineSeriesPrivate::pointReplaced(qsizetype index)
+{
+    const qsizetype n = m_points.size() - 1;
+    // The point is used by the equations of the segments on both sides of it
+    const qsizetype first = qMax(qsizetype(0), index - 1 - splineSolveMargin);
+    const qsizetype last = qMin(n, index + 1 + splineSolveMargin);
+    if (n <= 2 * splineSolveMargin || m_controlPoints.size() != n * 2
+        || (first == 0 && last == n)) {
+        calculateSplinePoints();
+        return;
+    }
+
+    solveControlPoints(first, last);
+}
+
+// Solves the first control points of the segments in [first, last) using the same
+// equations as calculateSplinePoints(), keeping the first control points of the segments
+// outside of the range fixed. Then updates the second control points which depend on them.
+void QSplineSeriesPrivate::solveControlPoints(qsizetype first, qsizetype last)
+{
+    const qsizetype n = m_points.size() - 1;
+    const qsizetype count = last - first;
+
+    auto diagonal = [n](qsizetype i) { return i == 0 ? 2.0 : (i == n - 1 ? 3.5 : 4.0); };
+    auto rhs = [this, n](qsizetype i) {
+        if (i == 0)
+            return m_points[0] + 2 * m_points[1];
+        if (i == n - 1)
+            return (8 * m_points[n - 1] + m_points[n]) / 2.0;
+        return 4 * m_points[i] + 2 * m_points[i + 1];
+    };
+
+    // Thomas algorithm, the sub- and superdiagonals are all 1
+    QList<qreal> temp(count);
+    QList<QPointF> result(count);
+    for (qsizetype r = 0; r < count; ++r) {
+        const qsizetype i = first + r;
+        QPointF value = rhs(i);
+        if (r == 0 && first > 0)
+            value -= m_controlPoints[(first - 1) * 2];
+        if (r == count - 1 && last < n)
+            value -= m_controlPoints[last * 2];
+
+        const qreal b = diagonal(i) - (r > 0 ? temp[r - 1] : 0.0);
+        temp[r] = 1.0 / b;
+        result[r] = (value - (r > 0 ? result[r - 1] : QPointF())) / b;
+    }
+    for (qsizetype r = count - 2; r >= 0; --r)
+        result[r] -= temp[r] * result[r + 1];
+
+    for (qsizetype r = 0; r < count; ++r)
+        m_controlPoints[(first + r) * 2] = result[r];
+
+    for (qsizetype i = qMax(qsizetype(0), first - 1); i < last; ++i) {
+        if (i < n - 1)
+            m_controlPoints[i * 2 + 1] = 2 * m_points[i + 1] - m_controlPoints[(i + 1) * 2];
+        else
+            m_controlPoints[i * 2 + 1] = (m_points[n] + m_controlPoints[i * 2]) / 2;
+    }
+}
+
 QList<qreal> QSplineSeriesPrivate::calculateControlPoints(const QList<qreal> &list)
 {
     QList<qreal> result;
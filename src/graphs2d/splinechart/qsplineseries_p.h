@@ -28,10 +28,16 @@ protected:
     qreal m_width;
     Qt::PenCapStyle m_capStyle;
     QList<QPointF> m_controlPoints;
+    bool m_decimationEnabled = false;
 
     void calculateSplinePoints();
     QList<qreal> calculateControlPoints(const QList<qreal> &list);
 
+    void pointsAppended(qsizetype count);
+    void pointsRemovedFromFront(qsizetype count);
+    void pointReplaced(qsizetype index);
+    void solveControlPoints(qsizetype first, qsizetype last);
+
 private:
     Q_DECLARE_PUBLIC(QSplineSeries)
 
@@ -162,6 +162,29 @@ QT_BEGIN_NAMESPACE
     columns define the data points.
 */
 
+/*!
+    \property QXYModelMapper::chunkSize
+    \since 6.10
+    \brief The number of points read from the model at a time when the series
+    is filled from the model.
+
+    When the value is greater than 0, the mapper reads this many points from the
+    model, appends them to the series, and reads the next points only after
+    control has returned to the event loop. This keeps the application
+    responsive while a large model is mapped. loadingProgress() is emitted
+    after each chunk.
+
+    The default value is 0, which reads the whole model at once.
+*/
+/*!
+    \qmlproperty qsizetype XYModelMapper::chunkSize
+    \since 6.10
+    The number of points read from the model at a time when the series is filled
+    from the model. When the value is greater than 0, the next points are read only
+    after control has returned to the event loop, and \l loadingProgress is emitted
+    after each chunk. The default value is 0, which reads the whole model at once.
+*/
+
 /*!
     \qmlsignal QXYModelMapper::seriesChanged()
 
@@ -198,6 +221,31 @@ QT_BEGIN_NAMESPACE
     This signal is emitted when the number of rows changes.
 */
 
+/*!
+    \qmlsignal XYModelMapper::chunkSizeChanged()
+    \since 6.10
+    This signal is emitted when the chunk size changes.
+*/
+
+/*!
+    \fn void QXYModelMapper::loadingProgress(qsizetype loadedCount, qsizetype totalCount)
+    \since 6.10
+
+    This signal is emitted after each chunk of points has been read from the
+    model, when chunkSize is greater than 0. \a loadedCount points of
+    \a totalCount have been added to the series. Loading has finished when
+    they are equal.
+*/
+/*!
+    \qmlsignal XYModelMapper::loadingProgress(qsizetype loadedCount, qsizetype totalCount)
+    \since 6.10
+
+    This signal is emitted after each chunk of points has been read from the
+    model, when \l chunkSize is greater than 0. \a loadedCount points of
+    \a totalCount have been added to the series. Loading has finished when
+    they are equal.
+*/
+
 /*!
     \qmlsignal BarModelMapper::orientationChanged()
     This signal is emitted when the orientation changes.
@@ -430,6 +478,25 @@ void QXYModelMapper::setYSection(qsizetype ySection)
     Q_EMIT ySectionChanged();
 }
 
+qsizetype QXYModelMapper::chunkSize() const
+{
+    Q_D(const QXYModelMapper);
+    return d->m_chunkSize;
+}
+
+void QXYModelMapper::setChunkSize(qsizetype chunkSize)
+{
+    Q_D(QXYModelMapper);
+    chunkSize = qMax(chunkSize, 0);
+    if (d->m_chunkSize == chunkSize)
+        return;
+    d->m_chunkSize = chunkSize;
+    // A load in progress continues with the new chunk size, or finishes at once
+    if (d->m_loadPosition >= 0 && chunkSize == 0)
+        d->initializeXYFromModel();
+    Q_EMIT chunkSizeChanged();
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 QXYModelMapperPrivate::QXYModelMapperPrivate() {}
@@ -466,6 +533,13 @@ QModelIndex QXYModelMapperPrivate::yModelIndex(qsizetype yIndex)
         return m_model->index(m_ySection, int(yIndex) + m_first);
 }
 
+qsizetype QXYModelMapperPrivate::mappedCount() const
+{
+    qsizetype count = m_orientation == Qt::Vertical ? m_model->rowCount() : m_model->columnCount();
+    count = qMax(count - m_first, 0);
+    return m_count == -1 ? count : qMin(count, m_count);
+}
+
 qreal QXYModelMapperPrivate::valueFromModel(QModelIndex index)
 {
     QVariant value = m_model->data(index, Qt::DisplayRole);
@@ -615,6 +689,12 @@ void QXYModelMapperPrivate::onModelRowsAdded(QModelIndex parent, qsizetype start
     if (m_modelSignalsBlock)
         return;
 
+    if (m_loadPosition >= 0) {
+        // Points past the load position are not in the series yet, so start over
+        initializeXYFromModel();
+        return;
+    }
+
     blockSeriesSignals();
     if (m_orientation == Qt::Vertical) {
         insertData(start, end);
@@ -631,6 +711,12 @@ void QXYModelMapperPrivate::onModelRowsRemoved(QModelIndex parent, qsizetype sta
     if (m_modelSignalsBlock)
         return;
 
+    if (m_loadPosition >= 0) {
+        // Points past the load position are not in the series yet, so start over
+        initializeXYFromModel();
+        return;
+    }
+
     blockSeriesSignals();
     if (m_orientation == Qt::Vertical) {
         removeData(start, end);
@@ -647,6 +733,12 @@ void QXYModelMapperPrivate::onModelColumnsAdded(QModelIndex parent, qsizetype st
     if (m_modelSignalsBlock)
         return;
 
+    if (m_loadPosition >= 0) {
+        // Points past the load position are not in the series yet, so start over
+        initializeXYFromModel();
+        return;
+    }
+
     blockSeriesSignals();
     if (m_orientation == Qt::Horizontal) {
         insertData(start, end);
@@ -663,6 +755,12 @@ void QXYModelMapperPrivate::onModelColumnsRemoved(QModelIndex parent, qsizetype
     if (m_modelSignalsBlock)
         return;
 
+    if (m_loadPosition >= 0) {
+        // Points past the load position are not in the series yet, so start over
+        initializeXYFromModel();
+        return;
+    }
+
     blockSeriesSignals();
     if (m_orientation == Qt::Horizontal) {
         removeData(start, end);
@@ -759,6 +857,11 @@ void QXYModelMapperPrivate::removeData(int start, int end)
 
 void QXYModelMapperPrivate::initializeXYFromModel()
 {
+    // Any load in progress is superseded
+    m_loadPosition = -1;
+    if (m_loadTimer)
+        m_loadTimer->stop();
+
     if (m_model == 0 || m_series == 0)
         return;
 
@@ -771,20 +874,25 @@ void QXYModelMapperPrivate::initializeXYFromModel()
     QModelIndex xIndex = xModelIndex(pointPos);
     QModelIndex yIndex = yModelIndex(pointPos);
     if (xIndex.isValid() && yIndex.isValid()) {
-        QList<QPointF> temp;
-
-        while (xIndex.isValid() && yIndex.isValid()) {
-            QPointF point;
-            point.setX(valueFromModel(xIndex));
-            point.setY(valueFromModel(yIndex));
-            temp.append(point);
-            pointPos++;
-            xIndex = xModelIndex(pointPos);
-            yIndex = yModelIndex(pointPos);
-            // Don't warn about invalid index after the first, those are valid and used to
-            // determine when we should end looping.
+        if (m_chunkSize > 0) {
+            // The first chunk is added right away, the rest from the event loop
+            m_loadPosition = 0;
+        } else {
+            QList<QPointF> temp;
+
+            while (xIndex.isValid() && yIndex.isValid()) {
+                QPointF point;
+                point.setX(valueFromModel(xIndex));
+                point.setY(valueFromModel(yIndex));
+                temp.append(point);
+                pointPos++;
+                xIndex = xModelIndex(pointPos);
+                yIndex = yModelIndex(pointPos);
+                // Don't warn about invalid index after the first, those are valid and used to
+                // determine when we should end looping.
+            }
+            QXYSeriesPrivate::get(m_series)->append(temp);
         }
-        QXYSeriesPrivate::get(m_series)->append(temp);
     } else {
         // Invalid index right off the bat means series will be left empty, so output a warning,
         // unless model is also empty
@@ -801,5 +909,51 @@ void QXYModelMapperPrivate::initializeXYFromModel()
     }
 
     blockSeriesSignals(false);
+
+    if (m_loadPosition >= 0)
+        loadChunk();
+}
+
+void QXYModelMapperPrivate::loadChunk()
+{
+    if (m_loadPosition < 0)
+        return;
+    if (m_model == 0 || m_series == 0) {
+        m_loadPosition = -1;
+        return;
+    }
+
+    blockSeriesSignals();
+    qsizetype pointPos = m_loadPosition;
+    const qsizetype chunkEnd = pointPos + m_chunkSize;
+    QModelIndex xIndex = xModelIndex(pointPos);
+    QModelIndex yIndex = yModelIndex(pointPos);
+    QList<QPointF> temp;
+    temp.reserve(m_chunkSize);
+    while (xIndex.isValid() && yIndex.isValid() && pointPos < chunkEnd) {
+        temp.append(QPointF(valueFromModel(xIndex), valueFromModel(yIndex)));
+        pointPos++;
+        xIndex = xModelIndex(pointPos);
+        yIndex = yModelIndex(pointPos);
+    }
+    if (!temp.isEmpty())
+        QXYSeriesPrivate::get(m_series)->append(temp);
+    blockSeriesSignals(false);
+
+    const bool finished = !xIndex.isValid() || !yIndex.isValid();
+    m_loadPosition = finished ? -1 : pointPos;
+    if (!finished) {
+        if (!m_loadTimer) {
+            Q_Q(QXYModelMapper);
+            m_loadTimer = new QTimer(q);
+            m_loadTimer->setSingleShot(true);
+            QObject::connect(m_loadTimer, &QTimer::timeout, q, [this] { loadChunk(); });
+        }
+        m_loadTimer->start(0);
+    }
+
+    Q_Q(QXYModelMapper);
+    Q_EMIT q->loadingProgress(pointPos, finished ? pointPos : qMax(mappedCount(), pointPos));
 }
+
 QT_END_NAMESPACE
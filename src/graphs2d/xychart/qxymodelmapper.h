@@ -27,6 +27,8 @@ class Q_GRAPHS_EXPORT QXYModelMapper : public QObject
     Q_PROPERTY(qsizetype count READ count WRITE setCount NOTIFY countChanged FINAL)
     Q_PROPERTY(Qt::Orientation orientation READ orientation WRITE setOrientation NOTIFY
                    orientationChanged FINAL)
+    Q_PROPERTY(qsizetype chunkSize READ chunkSize WRITE setChunkSize NOTIFY chunkSizeChanged
+                   REVISION(6, 10) FINAL)
     QML_NAMED_ELEMENT(XYModelMapper)
     Q_DECLARE_PRIVATE(QXYModelMapper)
 public:
@@ -53,6 +55,9 @@ public:
 
     qsizetype ySection() const;
     void setYSection(qsizetype ySection);
+
+    qsizetype chunkSize() const;
+    void setChunkSize(qsizetype chunkSize);
 Q_SIGNALS:
     void seriesChanged();
     void modelChanged();
@@ -61,6 +66,8 @@ Q_SIGNALS:
     void firstChanged();
     void countChanged();
     void orientationChanged();
+    Q_REVISION(6, 10) void chunkSizeChanged();
+    Q_REVISION(6, 10) void loadingProgress(qsizetype loadedCount, qsizetype totalCount);
 
 protected:
     QXYModelMapper(QXYModelMapperPrivate &dd, QObject *parent = nullptr);
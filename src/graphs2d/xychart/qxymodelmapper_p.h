@@ -12,6 +12,7 @@
 #ifndef QXYMODELMAPPER_P_H
 #define QXYMODELMAPPER_P_H
 
+#include <QtCore/QTimer>
 #include <QtGraphs/QXYModelMapper>
 #include <private/qobject_p.h>
 
@@ -41,6 +42,7 @@ public Q_SLOTS:
     void handleSeriesDestroyed();
 
     void initializeXYFromModel();
+    void loadChunk();
 
 private:
     QModelIndex xModelIndex(qsizetype xIndex);
@@ -50,6 +52,7 @@ private:
     void blockModelSignals(bool block = true);
     void blockSeriesSignals(bool block = true);
     qreal valueFromModel(QModelIndex index);
+    qsizetype mappedCount() const;
     void setValueToModel(QModelIndex index, qreal value);
 
 private:
@@ -62,6 +65,10 @@ private:
     qsizetype m_ySection = -1;
     bool m_seriesSignalsBlock = false;
     bool m_modelSignalsBlock = false;
+    qsizetype m_chunkSize = 0;
+    // Index of the next point to read while loading in chunks, or -1 when not loading
+    qsizetype m_loadPosition = -1;
+    QTimer *m_loadTimer = nullptr;
 
     Q_DISABLE_COPY_MOVE(QXYModelMapperPrivate)
 };
@@ -62,6 +62,12 @@ QT_BEGIN_NAMESPACE
     \since 6.9
 */
 
+/*!
+    \qmlsignal XYSeries::maxPointsChanged()
+    This signal is emitted when the \l maxPoints changes.
+    \since 6.10
+*/
+
 /*!
     \qmlsignal XYSeries::colorChanged(color color)
     This signal is emitted when the line color changes to \a color.
@@ -122,6 +128,43 @@ QXYSeries::QXYSeries(QXYSeriesPrivate &dd, QObject *parent)
     QObject::connect(this, &QXYSeries::pointsReplaced, this, &QAbstractSeries::update);
     QObject::connect(this, &QXYSeries::pointRemoved, this, &QAbstractSeries::update);
     QObject::connect(this, &QXYSeries::pointsRemoved, this, &QAbstractSeries::update);
+
+    // Appends and removals from the front are tracked so that renderers can reuse
+    // the coordinates of the unchanged points. Anything else needs a full update.
+    Q_D(QXYSeries);
+    QObject::connect(this, &QXYSeries::pointAdded, this, [d](qsizetype index) {
+        if (index == d->m_points.size() - 1)
+            d->m_pendingAppended++;
+        else
+            d->m_pendingFullUpdate = true;
+    });
+    QObject::connect(this, &QXYSeries::pointsAdded, this, [d](qsizetype start, qsizetype end) {
+        if (end == d->m_points.size() - 1)
+            d->m_pendingAppended += end - start + 1;
+        else
+            d->m_pendingFullUpdate = true;
+    });
+    QObject::connect(this, &QXYSeries::pointRemoved, this, [d](qsizetype index) {
+        if (index == 0)
+            d->m_pendingRemovedFront++;
+        else
+            d->m_pendingFullUpdate = true;
+    });
+    QObject::connect(this, &QXYSeries::pointsRemoved, this, [d](qsizetype index, qsizetype count) {
+        if (index == 0)
+            d->m_pendingRemovedFront += count;
+        else
+            d->m_pendingFullUpdate = true;
+    });
+    QObject::connect(this, &QXYSeries::pointReplaced, this, [d]() {
+        d->m_pendingFullUpdate = true;
+    });
+    QObject::connect(this, &QXYSeries::pointsReplaced, this, [d]() {
+        d->m_pendingFullUpdate = true;
+    });
+    QObject::connect(this, &QXYSeries::selectedPointsChanged, this, [d]() {
+        d->m_pendingFullUpdate = true;
+    });
 }
 
 /*!
@@ -149,14 +192,18 @@ void QXYSeries::append(QPointF point)
     if (isValidValue(point)) {
         if (d->m_graphTransition && d->m_graphTransition->initialized()
             && d->m_graphTransition->contains(QGraphAnimation::GraphAnimationType::GraphPoint)) {
+            // Stopping settles the running animation, so its point index is still valid
             d->m_graphTransition->stop();
+            d->evictOldest(1);
             d->m_graphTransition->onPointChanged(QGraphTransition::TransitionType::PointAdded,
                                                  d->m_points.size(),
                                                  point);
         } else {
+            const qsizetype evicted = d->evictOldest(1);
             d->m_points << point;
             emit pointAdded(d->m_points.size() - 1);
-            emit countChanged();
+            if (evicted != 1)
+                emit countChanged();
         }
     }
 }
@@ -166,11 +213,13 @@ void QXYSeries::append(QPointF point)
     Appends points with the coordinates \a points to the series.
     \note This is much faster than appending data points one by one.
     Emits \l pointsAdded when the points have been added.
+    \sa maxPoints
 */
 /*!
     Appends points with the coordinates \a points to the series.
     \note This is much faster than appending data points one by one.
     Emits \l pointsAdded when the points have been added.
+    \sa maxPoints
 */
 void QXYSeries::append(const QList<QPointF> &points)
 {
@@ -412,6 +461,7 @@ bool QXYSeries::take(QPointF point)
     for (int i = 0; i < d->m_points.size(); ++i) {
         if (d->m_points[i] == point) {
             d->m_points.removeAt(i);
+            d->m_pendingFullUpdate = true;
             return true;
         }
     }
@@ -742,6 +792,51 @@ qsizetype QXYSeries::find(QPointF point) const
     return -1;
 }
 
+/*!
+    \property QXYSeries::maxPoints
+    \brief The maximum number of points kept in the series.
+    \since 6.10
+
+    When set to a value larger than \c 0, appending points to a full series
+    removes the oldest points from the beginning of the series, so that it works
+    like a fixed-size buffer for streaming data. Removing the oldest points does
+    not move the remaining points in memory, and renderers only map the newly
+    appended points when the axes have not changed. Emits \l pointsRemoved for
+    the removed points before the append signals.
+
+    Reducing the value removes the oldest points immediately. By default,
+    maxPoints is \c 0, meaning that the number of points is not limited.
+*/
+/*!
+    \qmlproperty int XYSeries::maxPoints
+    \since 6.10
+    The maximum number of points kept in the series. When set to a value larger
+    than \c 0, appending points to a full series removes the oldest points from
+    the beginning of the series, so that it works like a fixed-size buffer for
+    streaming data.
+
+    Reducing the value removes the oldest points immediately. By default,
+    maxPoints is \c 0, meaning that the number of points is not limited.
+*/
+qsizetype QXYSeries::maxPoints() const
+{
+    Q_D(const QXYSeries);
+    return d->m_maxPoints;
+}
+
+void QXYSeries::setMaxPoints(qsizetype maxPoints)
+{
+    Q_D(QXYSeries);
+    maxPoints = qMax(qsizetype(0), maxPoints);
+    if (d->m_maxPoints == maxPoints)
+        return;
+    d->m_maxPoints = maxPoints;
+    emit maxPointsChanged();
+
+    if (maxPoints > 0 && d->m_points.size() > maxPoints)
+        removeMultiple(0, d->m_points.size() - maxPoints);
+}
+
 QXYSeries::~QXYSeries() {}
 
 /*!
@@ -979,26 +1074,65 @@ void QXYSeriesPrivate::append(const QList<QPointF> &points)
                 && m_graphTransition->contains(QGraphAnimation::GraphAnimationType::GraphPoint);
 
     if (anim) {
-        m_graphTransition->stop();
-        qsizetype index = m_points.size();
-
         for (auto point : points) {
             if (isValidValue(point)) {
+                // Stopping settles the running animation, so its point index is still valid
                 m_graphTransition->stop();
+                evictOldest(1);
                 m_graphTransition->onPointChanged(QGraphTransition::TransitionType::PointAdded,
-                                                  index,
+                                                  m_points.size(),
                                                   point);
-                index++;
             }
         }
     } else {
+        Q_Q(QXYSeries);
+        // Only the newest points fit when appending more than maxPoints
+        const qsizetype skipped = m_maxPoints > 0
+                                      ? qMax(qsizetype(0), points.size() - m_maxPoints)
+                                      : 0;
+        const qsizetype evicted = evictOldest(points.size() - skipped);
+
         qsizetype start = m_points.size();
-        m_points.append(points);
+        m_points.append(points.constBegin() + skipped, points.constEnd());
 
-        Q_Q(QXYSeries);
         Q_EMIT q->pointsAdded(start, m_points.size() - 1);
-        Q_EMIT q->countChanged();
+        if (evicted == 0 || evicted != points.size() - skipped)
+            Q_EMIT q->countChanged();
     }
 }
 
+// Removes the oldest points when the incoming points would not fit into maxPoints.
+// Returns the number of removed points.
+qsizetype QXYSeriesPrivate::evictOldest(qsizetype incomingCount)
+{
+    if (m_maxPoints <= 0)
+        return 0;
+
+    const qsizetype count = qMin(m_points.size(), m_points.size() + incomingCount - m_maxPoints);
+    if (count <= 0)
+        return 0;
+
+    // Removing from the front only moves the begin of the list, the free space is
+    // reused by the following appends.
+    m_points.remove(0, count);
+
+    bool callSignal = false;
+    if (!m_selectedPoints.isEmpty()) {
+        QSet<qsizetype> selectedAfterRemoving;
+        for (const qsizetype &selectedPointIndex : std::as_const(m_selectedPoints)) {
+            if (selectedPointIndex >= count)
+                selectedAfterRemoving << selectedPointIndex - count;
+            callSignal = true;
+        }
+        m_selectedPoints = selectedAfterRemoving;
+    }
+
+    Q_Q(QXYSeries);
+    Q_EMIT q->pointsRemoved(0, count);
+    if (callSignal)
+        Q_EMIT q->selectedPointsChanged();
+
+    return count;
+}
+
 QT_END_NAMESPACE
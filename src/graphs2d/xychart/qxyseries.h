@@ -26,6 +26,8 @@ class Q_GRAPHS_EXPORT QXYSeries : public QAbstractSeries
     Q_PROPERTY(bool draggable READ isDraggable WRITE setDraggable NOTIFY draggableChanged FINAL)
     Q_PROPERTY(QList<qsizetype> selectedPoints READ selectedPoints NOTIFY selectedPointsChanged FINAL)
     Q_PROPERTY(qsizetype count READ count NOTIFY countChanged FINAL)
+    Q_PROPERTY(qsizetype maxPoints READ maxPoints WRITE setMaxPoints NOTIFY maxPointsChanged
+                   REVISION(6, 10) FINAL)
 
 protected:
     explicit QXYSeries(QXYSeriesPrivate &dd, QObject *parent = nullptr);
@@ -64,6 +66,9 @@ public:
 
     qsizetype count() const;
 
+    qsizetype maxPoints() const;
+    void setMaxPoints(qsizetype maxPoints);
+
     Q_INVOKABLE bool isPointSelected(qsizetype index) const;
     Q_INVOKABLE void selectPoint(qsizetype index);
     Q_INVOKABLE void deselectPoint(qsizetype index);
@@ -98,6 +103,7 @@ Q_SIGNALS:
     void draggableChanged();
     void seriesUpdated();
     void countChanged();
+    Q_REVISION(6, 10) void maxPointsChanged();
 
     Q_REVISION(6, 9) void clicked(QPoint point);
     Q_REVISION(6, 9) void doubleClicked(QPoint point);
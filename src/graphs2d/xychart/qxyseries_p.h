@@ -33,6 +33,7 @@ public:
     bool isPointSelected(qsizetype index) const;
 
     void append(const QList<QPointF> &points);
+    qsizetype evictOldest(qsizetype incomingCount);
 
 protected:
     QList<QPointF> m_points;
@@ -42,12 +43,19 @@ protected:
     QQmlComponent *m_pointDelegate = nullptr;
     QGraphTransition *m_graphTransition = nullptr;
     bool m_draggable = false;
+    qsizetype m_maxPoints = 0;
+
+    // Changes since the renderer last mapped the points, so it can update incrementally
+    qsizetype m_pendingRemovedFront = 0;
+    qsizetype m_pendingAppended = 0;
+    bool m_pendingFullUpdate = true;
 
 private:
     Q_DECLARE_PUBLIC(QXYSeries)
 
     friend class QGraphPointAnimation;
     friend class QGraphTransition;
+    friend class PointRenderer;
 };
 
 QT_END_NAMESPACE
@@ -3,8 +3,116 @@
 
 #include "abstractitemmodelhandler_p.h"
 
+#include <algorithm>
+
 QT_BEGIN_NAMESPACE
 
+// Returns whether the pattern is of the form ^...$ as a whole, which is not the case
+// when it has alternatives at its top level, like ^a|b$
+static bool isAnchoredPattern(const QString &pattern)
+{
+    if (!pattern.startsWith(QLatin1Char('^')) || pattern.contains(QLatin1String("\\Q")))
+        return false;
+
+    int depth = 0;
+    bool inClass = false;
+    bool endAnchor = false;
+    for (qsizetype i = 1; i < pattern.size(); ++i) {
+        const QChar c = pattern.at(i);
+        endAnchor = false;
+        if (c == QLatin1Char('\\')) {
+            ++i;
+        } else if (inClass) {
+            inClass = c != QLatin1Char(']');
+        } else if (c == QLatin1Char('[')) {
+            // A closing bracket right after the opening one is a literal
+            inClass = true;
+            if (pattern.mid(i + 1, 1) == QLatin1String("^"))
+                ++i;
+            if (pattern.mid(i + 1, 1) == QLatin1String("]"))
+                ++i;
+        } else if (c == QLatin1Char('(')) {
+            ++depth;
+        } else if (c == QLatin1Char(')')) {
+            --depth;
+        } else if (c == QLatin1Char('|') && depth == 0) {
+            return false;
+        } else if (c == QLatin1Char('$') && depth == 0) {
+            endAnchor = true;
+        }
+    }
+    return endAnchor;
+}
+
+void RoleExtractor::setPattern(const QRegularExpression &pattern, const QString &replace)
+{
+    m_pattern = pattern;
+    m_replace = replace;
+    m_havePattern = !m_pattern.namedCaptureGroups().isEmpty() && m_pattern.isValid();
+    m_captureGroup = -1;
+    if (!m_havePattern)
+        return;
+
+    // Without multiline matching, a pattern anchored at the start can match only once
+    const QRegularExpression::PatternOptions options = m_pattern.patternOptions();
+    const bool anchored = isAnchoredPattern(m_pattern.pattern())
+                          && !options.testFlag(QRegularExpression::MultilineOption)
+                          && !options.testFlag(QRegularExpression::ExtendedPatternSyntaxOption);
+    if (!anchored)
+        return;
+
+    static const QRegularExpression backReference(QStringLiteral("^\\\\(\\d{1,2})$"));
+    const QRegularExpressionMatch match = backReference.match(m_replace);
+    if (match.hasMatch()) {
+        const int group = match.capturedView(1).toInt();
+        if (group <= m_pattern.captureCount())
+            m_captureGroup = group;
+    }
+}
+
+float RoleExtractor::toFloat(const QVariant &data) const
+{
+    if (!m_havePattern) {
+        // Numeric data is read directly instead of going through the conversion machinery
+        switch (data.typeId()) {
+        case QMetaType::Float:
+            return *static_cast<const float *>(data.constData());
+        case QMetaType::Double:
+            return float(*static_cast<const double *>(data.constData()));
+        case QMetaType::Int:
+            return float(*static_cast<const int *>(data.constData()));
+        default:
+            return data.toFloat();
+        }
+    }
+
+    QString subject = data.toString();
+    if (m_captureGroup >= 0) {
+        const QRegularExpressionMatch match = m_pattern.match(subject);
+        if (!match.hasMatch())
+            return subject.toFloat();
+        if (match.capturedStart(0) == 0 && match.capturedEnd(0) == subject.size())
+            return match.capturedView(m_captureGroup).toFloat();
+    }
+    return subject.replace(m_pattern, m_replace).toFloat();
+}
+
+QString RoleExtractor::toString(const QVariant &data) const
+{
+    QString subject = data.toString();
+    if (!m_havePattern)
+        return subject;
+
+    if (m_captureGroup >= 0) {
+        const QRegularExpressionMatch match = m_pattern.match(subject);
+        if (!match.hasMatch())
+            return subject;
+        if (match.capturedStart(0) == 0 && match.capturedEnd(0) == subject.size())
+            return match.captured(m_captureGroup);
+    }
+    return subject.replace(m_pattern, m_replace);
+}
+
 AbstractItemModelHandler::AbstractItemModelHandler(QObject *parent)
     : QObject(parent)
     , resolvePending(0)
@@ -19,6 +127,31 @@ AbstractItemModelHandler::AbstractItemModelHandler(QObject *parent)
 
 AbstractItemModelHandler::~AbstractItemModelHandler() {}
 
+// Sets the roles fetched by fetchRoles(). Unmapped and duplicate roles are skipped.
+void AbstractItemModelHandler::setFetchRoles(std::initializer_list<int> roles)
+{
+    m_fetchRoleData.clear();
+    for (int role : roles) {
+        if (role == noRoleIndex)
+            continue;
+        if (std::none_of(m_fetchRoleData.cbegin(),
+                         m_fetchRoleData.cend(),
+                         [role](const QModelRoleData &data) { return data.role() == role; })) {
+            m_fetchRoleData.append(QModelRoleData(role));
+        }
+    }
+}
+
+// Fetches all roles set with setFetchRoles() for the index in a single multiData() call.
+QModelRoleDataSpan AbstractItemModelHandler::fetchRoles(const QModelIndex &index)
+{
+    for (QModelRoleData &data : m_fetchRoleData)
+        data.clearData();
+    QModelRoleDataSpan span(m_fetchRoleData);
+    m_itemModel->multiData(index, span);
+    return span;
+}
+
 void AbstractItemModelHandler::setItemModel(QAbstractItemModel *itemModel)
 {
     if (itemModel != m_itemModel.data()) {
@@ -17,10 +17,30 @@
 #include <QtGraphs/private/qgraphsglobal_p.h>
 #include <QtCore/QAbstractItemModel>
 #include <QtCore/QPointer>
+#include <QtCore/QRegularExpression>
 #include <QtCore/QTimer>
 
 QT_BEGIN_NAMESPACE
 
+// Converts role data to floats and strings, applying the role pattern and replace of the proxy.
+// Patterns are analyzed once, so that the common case of an anchored pattern replaced with one
+// of its capture groups is parsed from the match without building the replaced string.
+class RoleExtractor
+{
+public:
+    void setPattern(const QRegularExpression &pattern, const QString &replace);
+    bool hasPattern() const { return m_havePattern; }
+
+    float toFloat(const QVariant &data) const;
+    QString toString(const QVariant &data) const;
+
+private:
+    QRegularExpression m_pattern;
+    QString m_replace;
+    int m_captureGroup = -1;
+    bool m_havePattern = false;
+};
+
 class AbstractItemModelHandler : public QObject
 {
     Q_OBJECT
@@ -63,11 +83,15 @@ Q_SIGNALS:
 protected:
     virtual void resolveModel() = 0;
 
+    void setFetchRoles(std::initializer_list<int> roles);
+    QModelRoleDataSpan fetchRoles(const QModelIndex &index);
+
     QPointer<QAbstractItemModel> m_itemModel; // Not owned
     bool resolvePending;
     QTimer m_resolveTimer;
     bool m_fullReset;
     const int noRoleIndex = -1;
+    QList<QModelRoleData> m_fetchRoleData;
 
 private:
     Q_DISABLE_COPY(AbstractItemModelHandler)
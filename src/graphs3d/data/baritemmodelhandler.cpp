@@ -4,6 +4,11 @@
 #include "baritemmodelhandler_p.h"
 #include "qbar3dseries_p.h"
 
+#include <QtCore/QPromise>
+#include <QtCore/QThreadPool>
+
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 BarItemModelHandler::BarItemModelHandler(QItemModelBarDataProxy *proxy, QObject *parent)
@@ -13,11 +18,31 @@ BarItemModelHandler::BarItemModelHandler(QItemModelBarDataProxy *proxy, QObject
     , m_columnCount(0)
     , m_valueRole(noRoleIndex)
     , m_rotationRole(noRoleIndex)
-    , m_haveValuePattern(false)
-    , m_haveRotationPattern(false)
-{}
+    , m_rowRole(noRoleIndex)
+    , m_columnRole(noRoleIndex)
+    , m_resolving(false)
+    , m_resolveAgain(false)
+{
+    QObject::connect(&m_resolveWatcher,
+                     &QFutureWatcher<ResolveJob>::finished,
+                     this,
+                     &BarItemModelHandler::handleResolveFinished);
+}
+
+BarItemModelHandler::~BarItemModelHandler()
+{
+    m_resolveWatcher.cancel();
+}
 
-BarItemModelHandler::~BarItemModelHandler() {}
+float BarItemModelHandler::readValue(const QModelRoleDataSpan &data) const
+{
+    return m_valueExtractor.toFloat(*data.dataForRole(m_valueRole));
+}
+
+float BarItemModelHandler::readRotation(const QModelRoleDataSpan &data) const
+{
+    return m_rotationExtractor.toFloat(*data.dataForRole(m_rotationRole));
+}
 
 void BarItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
                                             const QModelIndex &bottomRight,
@@ -25,39 +50,28 @@ void BarItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
 {
     // Do nothing if full reset already pending
     if (!m_fullReset) {
-        if (!m_proxy->useModelCategories()) {
-            // If the data model doesn't directly map rows and columns, we cannot
-            // optimize
+        int startRow = qMin(topLeft.row(), bottomRight.row());
+        int endRow = qMax(topLeft.row(), bottomRight.row());
+        int startCol = qMin(topLeft.column(), bottomRight.column());
+        int endCol = qMax(topLeft.column(), bottomRight.column());
+
+        if (m_resolving) {
+            // A resolve in progress would overwrite the change with the data copied
+            // before it
             AbstractItemModelHandler::handleDataChanged(topLeft, bottomRight, roles);
+        } else if (!m_proxy->useModelCategories()) {
+            // Role mapped items can be updated in place as long as they stay in the same
+            // bar, otherwise the whole model needs to be resolved again
+            if (!updateRoleMappedItems(startRow, endRow, startCol, endCol))
+                AbstractItemModelHandler::handleDataChanged(topLeft, bottomRight, roles);
         } else {
-            int startRow = qMin(topLeft.row(), bottomRight.row());
-            int endRow = qMax(topLeft.row(), bottomRight.row());
-            int startCol = qMin(topLeft.column(), bottomRight.column());
-            int endCol = qMax(topLeft.column(), bottomRight.column());
-
             for (int i = startRow; i <= endRow; i++) {
                 for (int j = startCol; j <= endCol; j++) {
-                    QModelIndex index = m_itemModel->index(i, j);
+                    QModelRoleDataSpan data = fetchRoles(m_itemModel->index(i, j));
                     QBarDataItem item;
-                    QVariant valueVar = index.data(m_valueRole);
-                    float value;
-                    if (m_haveValuePattern)
-                        value = valueVar.toString().replace(m_valuePattern, m_valueReplace).toFloat();
-                    else
-                        value = valueVar.toFloat();
-                    item.setValue(value);
-                    if (m_rotationRole != noRoleIndex) {
-                        QVariant rotationVar = index.data(m_rotationRole);
-                        float rotation;
-                        if (m_haveRotationPattern) {
-                            rotation = rotationVar.toString()
-                                           .replace(m_rotationPattern, m_rotationReplace)
-                                           .toFloat();
-                        } else {
-                            rotation = rotationVar.toFloat();
-                        }
-                        item.setRotation(rotation);
-                    }
+                    item.setValue(readValue(data));
+                    if (m_rotationRole != noRoleIndex)
+                        item.setRotation(readRotation(data));
                     m_proxy->setItem(i, j, item);
                 }
             }
@@ -65,9 +79,312 @@ void BarItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
     }
 }
 
+bool BarItemModelHandler::updateRoleMappedItems(int startRow,
+                                                int endRow,
+                                                int startColumn,
+                                                int endColumn)
+{
+    const int modelColumnCount = m_itemModel->columnCount();
+    if (m_indexCells.size() != qsizetype(m_itemModel->rowCount()) * modelColumnCount
+        || !m_columnCount) {
+        return false;
+    }
+
+    const QItemModelBarDataProxy::MultiMatchBehavior behavior = m_proxy->multiMatchBehavior();
+    const bool cumulative = behavior == QItemModelBarDataProxy::MultiMatchBehavior::Average
+                            || behavior == QItemModelBarDataProxy::MultiMatchBehavior::Cumulative;
+    const bool countMatches = behavior == QItemModelBarDataProxy::MultiMatchBehavior::Average;
+    const QStringList rowList = m_proxy->rowCategories();
+    const QStringList columnList = m_proxy->columnCategories();
+
+    for (int i = startRow; i <= endRow; i++) {
+        for (int j = startColumn; j <= endColumn; j++) {
+            QModelRoleDataSpan data = fetchRoles(m_itemModel->index(i, j));
+            const QString rowRoleStr = m_rowExtractor.toString(*data.dataForRole(m_rowRole));
+            const QString columnRoleStr = m_columnExtractor.toString(
+                *data.dataForRole(m_columnRole));
+
+            const qsizetype modelIndex = qsizetype(i) * modelColumnCount + j;
+            const int cell = m_indexCells.at(modelIndex);
+            if (cell < 0) {
+                // Items outside the categories only matter if they moved into them
+                if (rowList.contains(rowRoleStr) && columnList.contains(columnRoleStr))
+                    return false;
+                continue;
+            }
+
+            const qsizetype row = cell / m_columnCount;
+            const qsizetype column = cell % m_columnCount;
+            if (rowList.at(row) != rowRoleStr || columnList.at(column) != columnRoleStr)
+                return false;
+
+            QBarDataItem item = m_proxy->itemAt(row, column);
+            const float value = readValue(data);
+            if (cumulative) {
+                // Combined bars are adjusted by the change of this item only
+                const float divisor = countMatches ? float(m_cellMatchCounts.at(cell)) : 1.0f;
+                item.setValue(item.value() + (value - m_indexValues.at(modelIndex)) / divisor);
+                m_indexValues[modelIndex] = value;
+                if (m_rotationRole != noRoleIndex) {
+                    const float rotation = readRotation(data);
+                    item.setRotation(item.rotation()
+                                     + (rotation - m_indexRotations.at(modelIndex)) / divisor);
+                    m_indexRotations[modelIndex] = rotation;
+                }
+            } else if (m_cellSources.at(cell) == modelIndex) {
+                item.setValue(value);
+                if (m_rotationRole != noRoleIndex)
+                    item.setRotation(readRotation(data));
+            } else {
+                // Another item provides the value of the bar
+                continue;
+            }
+            m_proxy->setItem(row, column, item);
+        }
+    }
+    return true;
+}
+
+void BarItemModelHandler::clearRoleMapping()
+{
+    m_indexCells.clear();
+    m_indexValues.clear();
+    m_indexRotations.clear();
+    m_cellSources.clear();
+    m_cellMatchCounts.clear();
+}
+
+template<typename Fetch, typename Canceled>
+bool BarItemModelHandler::buildArray(ResolveJob &job, Fetch fetch, Canceled canceled)
+{
+    const bool haveRotation = job.rotationRole != -1;
+    auto valueOf = [&job](const QModelRoleDataSpan &data) {
+        return job.valueExtractor.toFloat(*data.dataForRole(job.valueRole));
+    };
+    auto rotationOf = [&job](const QModelRoleDataSpan &data) {
+        return job.rotationExtractor.toFloat(*data.dataForRole(job.rotationRole));
+    };
+    QBarDataArray &array = job.array;
+
+    if (job.useModelCategories) {
+        // If dimensions have changed, recreate the array
+        if (array.size() != job.rowCount
+            || (!array.isEmpty() && array.at(0).size() != job.columnCount)) {
+            array.clear();
+            array.reserve(job.rowCount);
+            for (int i = 0; i < job.rowCount; i++)
+                array.append(QBarDataRow(job.columnCount));
+        }
+        for (int i = 0; i < job.rowCount; i++) {
+            if (canceled())
+                return false;
+            QBarDataRow &newProxyRow = array[i];
+            for (int j = 0; j < job.columnCount; j++) {
+                QModelRoleDataSpan data = fetch(i, j);
+                newProxyRow[j].setValue(valueOf(data));
+                if (haveRotation)
+                    newProxyRow[j].setRotation(rotationOf(data));
+            }
+        }
+        job.arrayColumnCount = job.columnCount;
+        return true;
+    }
+
+    const bool cumulative
+        = job.multiMatchBehavior == QItemModelBarDataProxy::MultiMatchBehavior::Average
+          || job.multiMatchBehavior == QItemModelBarDataProxy::MultiMatchBehavior::Cumulative;
+    const bool countMatches = job.multiMatchBehavior
+                              == QItemModelBarDataProxy::MultiMatchBehavior::Average;
+    const bool takeFirst = job.multiMatchBehavior
+                           == QItemModelBarDataProxy::MultiMatchBehavior::First;
+
+    // Intern row and column strings to ids in the order they first appear, which is
+    // also the order of generated categories. Each string is hashed only once per item.
+    const qsizetype indexCount = qsizetype(job.rowCount) * job.columnCount;
+    QHash<QString, int> rowIds;
+    QHash<QString, int> columnIds;
+    QStringList rowIdList;
+    QStringList columnIdList;
+    QList<int> indexRowIds(indexCount);
+    QList<int> indexColumnIds(indexCount);
+    job.indexValues.resize(indexCount);
+    if (haveRotation)
+        job.indexRotations.resize(indexCount);
+
+    for (int i = 0; i < job.rowCount; i++) {
+        if (canceled())
+            return false;
+        for (int j = 0; j < job.columnCount; j++) {
+            QModelRoleDataSpan data = fetch(i, j);
+            const QString rowRoleStr = job.rowExtractor.toString(*data.dataForRole(job.rowRole));
+            const QString columnRoleStr = job.columnExtractor.toString(
+                *data.dataForRole(job.columnRole));
+            const qsizetype modelIndex = qsizetype(i) * job.columnCount + j;
+            auto rowId = rowIds.constFind(rowRoleStr);
+            if (rowId == rowIds.constEnd()) {
+                rowId = rowIds.insert(rowRoleStr, int(rowIdList.size()));
+                rowIdList.append(rowRoleStr);
+            }
+            indexRowIds[modelIndex] = rowId.value();
+            auto columnId = columnIds.constFind(columnRoleStr);
+            if (columnId == columnIds.constEnd()) {
+                columnId = columnIds.insert(columnRoleStr, int(columnIdList.size()));
+                columnIdList.append(columnRoleStr);
+            }
+            indexColumnIds[modelIndex] = columnId.value();
+            job.indexValues[modelIndex] = valueOf(data);
+            if (haveRotation)
+                job.indexRotations[modelIndex] = rotationOf(data);
+        }
+    }
+
+    if (job.generateRows)
+        job.rowCategories = rowIdList;
+    if (job.generateColumns)
+        job.columnCategories = columnIdList;
+    const QStringList &rowList = job.rowCategories;
+    const QStringList &columnList = job.columnCategories;
+    const qsizetype columnCount = columnList.size();
+
+    // If dimensions have changed, recreate the array
+    if (array.size() != rowList.size()
+        || (!array.isEmpty() && array.at(0).size() != columnCount)) {
+        array.clear();
+        array.reserve(rowList.size());
+        for (int i = 0; i < rowList.size(); i++)
+            array.append(QBarDataRow(columnCount));
+    }
+
+    if (job.rowLabels.isEmpty())
+        job.rowLabels = rowList;
+    if (job.columnLabels.isEmpty())
+        job.columnLabels = columnList;
+
+    job.arrayColumnCount = columnCount;
+
+    // Map ids to their positions in the categories
+    QList<int> rowPositions(rowIdList.size(), -1);
+    QList<int> columnPositions(columnIdList.size(), -1);
+    for (qsizetype i = rowList.size() - 1; i >= 0; i--) {
+        auto it = rowIds.constFind(rowList.at(i));
+        if (it != rowIds.constEnd())
+            rowPositions[it.value()] = int(i);
+    }
+    for (qsizetype i = columnList.size() - 1; i >= 0; i--) {
+        auto it = columnIds.constFind(columnList.at(i));
+        if (it != columnIds.constEnd())
+            columnPositions[it.value()] = int(i);
+    }
+
+    if (canceled())
+        return false;
+
+    // Accumulate items into a flat buffer of bars in a single pass. The mapping from
+    // model indexes to bars is kept, so that data changes can be applied to single
+    // bars without resolving the whole model again.
+    const qsizetype cellCount = rowList.size() * columnCount;
+    QList<float> cellValues(cellCount);
+    QList<float> cellRotations(haveRotation ? cellCount : 0);
+    job.indexCells.resize(indexCount);
+    job.cellSources.fill(-1, cellCount);
+    if (countMatches)
+        job.cellMatchCounts.fill(0, cellCount);
+    for (qsizetype i = 0; i < indexCount; i++) {
+        const int row = rowPositions.at(indexRowIds.at(i));
+        const int column = columnPositions.at(indexColumnIds.at(i));
+        if (row < 0 || column < 0) {
+            job.indexCells[i] = -1;
+            continue;
+        }
+        const int cell = int(row * columnCount + column);
+        job.indexCells[i] = cell;
+        if (cumulative) {
+            cellValues[cell] += job.indexValues.at(i);
+            if (haveRotation)
+                cellRotations[cell] += job.indexRotations.at(i);
+            if (countMatches)
+                job.cellMatchCounts[cell]++;
+        } else if (!takeFirst || job.cellSources.at(cell) < 0) {
+            job.cellSources[cell] = i;
+            cellValues[cell] = job.indexValues.at(i);
+            if (haveRotation)
+                cellRotations[cell] = job.indexRotations.at(i);
+        }
+    }
+
+    // Create new data array from the accumulated bars
+    for (int i = 0; i < rowList.size(); i++) {
+        QBarDataRow &newProxyRow = array[i];
+        for (int j = 0; j < columnCount; j++) {
+            const qsizetype cell = i * columnCount + j;
+            float divisor = 1.0f;
+            if (countMatches && job.cellMatchCounts.at(cell))
+                divisor = float(job.cellMatchCounts.at(cell));
+            newProxyRow[j].setValue(cellValues.at(cell) / divisor);
+            if (haveRotation)
+                newProxyRow[j].setRotation(cellRotations.at(cell) / divisor);
+        }
+    }
+
+    // Per item values are only needed for adjusting combined bars on data changes
+    if (!cumulative) {
+        job.indexValues.clear();
+        job.indexRotations.clear();
+    }
+    return true;
+}
+
+void BarItemModelHandler::applyResolveJob(ResolveJob &job)
+{
+    if (!job.useModelCategories) {
+        if (job.generateRows)
+            m_proxy->d_func()->m_rowCategories = job.rowCategories;
+        if (job.generateColumns)
+            m_proxy->d_func()->m_columnCategories = job.columnCategories;
+    }
+
+    m_columnCount = job.arrayColumnCount;
+    m_indexCells = std::move(job.indexCells);
+    m_indexValues = std::move(job.indexValues);
+    m_indexRotations = std::move(job.indexRotations);
+    m_cellSources = std::move(job.cellSources);
+    m_cellMatchCounts = std::move(job.cellMatchCounts);
+
+    m_proxyArray = std::move(job.array);
+    m_proxy->resetArray(m_proxyArray, job.rowLabels, job.columnLabels);
+}
+
+void BarItemModelHandler::handleResolveFinished()
+{
+    QFuture<ResolveJob> future = m_resolveWatcher.future();
+    if (!m_resolving || future.isCanceled())
+        return;
+
+    m_resolving = false;
+    if (future.resultCount()) {
+        ResolveJob job = future.takeResult();
+        applyResolveJob(job);
+    }
+
+    // Pick up the changes that were made while resolving
+    if (m_resolveAgain) {
+        m_resolveAgain = false;
+        resolveModel();
+    }
+}
+
 // Resolve entire item model into QBarDataArray.
 void BarItemModelHandler::resolveModel()
 {
+    // Restarting a resolve in progress on every change could keep it from ever
+    // finishing, so let it complete and resolve once more when it has
+    if (m_resolving) {
+        m_resolveAgain = true;
+        return;
+    }
+
+    clearRoleMapping();
+
     if (m_itemModel.isNull()) {
         m_proxy->resetArray();
         return;
@@ -79,212 +396,93 @@ void BarItemModelHandler::resolveModel()
         return;
     }
 
-    // Value and rotation patterns can be reused on single item changes,
-    // so store them to member variables.
-    QRegularExpression rowPattern(m_proxy->rowRolePattern());
-    QRegularExpression colPattern(m_proxy->columnRolePattern());
-    m_valuePattern = m_proxy->valueRolePattern();
-    m_rotationPattern = m_proxy->rotationRolePattern();
-    QString rowReplace = m_proxy->rowRoleReplace();
-    QString colReplace = m_proxy->columnRoleReplace();
-    m_valueReplace = m_proxy->valueRoleReplace();
-    m_rotationReplace = m_proxy->rotationRoleReplace();
-    bool haveRowPattern = !rowPattern.namedCaptureGroups().isEmpty() && rowPattern.isValid();
-    bool haveColPattern = !colPattern.namedCaptureGroups().isEmpty() && colPattern.isValid();
-    m_haveValuePattern = !m_valuePattern.namedCaptureGroups().isEmpty() && m_valuePattern.isValid();
-    m_haveRotationPattern = !m_rotationPattern.namedCaptureGroups().isEmpty()
-                            && m_rotationPattern.isValid();
-
-    QStringList rowLabels;
-    QStringList columnLabels;
+    // Patterns can be reused on single item changes, so store them to member variables.
+    m_rowExtractor.setPattern(m_proxy->rowRolePattern(), m_proxy->rowRoleReplace());
+    m_columnExtractor.setPattern(m_proxy->columnRolePattern(), m_proxy->columnRoleReplace());
+    m_valueExtractor.setPattern(m_proxy->valueRolePattern(), m_proxy->valueRoleReplace());
+    m_rotationExtractor.setPattern(m_proxy->rotationRolePattern(),
+                                   m_proxy->rotationRoleReplace());
 
     QHash<int, QByteArray> roleHash = m_itemModel->roleNames();
 
     // Default value role to display role if no mapping
     m_valueRole = roleHash.key(m_proxy->valueRole().toLatin1(), Qt::DisplayRole);
     m_rotationRole = roleHash.key(m_proxy->rotationRole().toLatin1(), noRoleIndex);
-    int rowCount = m_itemModel->rowCount();
-    int columnCount = m_itemModel->columnCount();
 
-    if (m_proxy->useModelCategories()) {
+    ResolveJob job;
+    job.rowCount = m_itemModel->rowCount();
+    job.columnCount = m_itemModel->columnCount();
+    job.useModelCategories = m_proxy->useModelCategories();
+
+    if (job.useModelCategories) {
+        setFetchRoles({m_valueRole, m_rotationRole});
         if (!m_proxy->series())
             return;
-        // If dimensions have changed, recreate the array
-        if (m_proxyArray.data() != m_proxy->series()->dataArray().data()
-            || columnCount != m_columnCount || rowCount != m_proxyArray.size()) {
-            m_proxyArray.reserve(rowCount);
-            for (int i = 0; i < rowCount; i++)
-                m_proxyArray.append(QBarDataRow(columnCount));
-        }
-        for (int i = 0; i < rowCount; i++) {
-            QBarDataRow &newProxyRow = m_proxyArray[i];
-            for (int j = 0; j < columnCount; j++) {
-                QModelIndex index = m_itemModel->index(i, j);
-                QVariant valueVar = index.data(m_valueRole);
-                float value;
-                if (m_haveValuePattern)
-                    value = valueVar.toString().replace(m_valuePattern, m_valueReplace).toFloat();
-                else
-                    value = valueVar.toFloat();
-                newProxyRow[j].setValue(value);
-                if (m_rotationRole != noRoleIndex) {
-                    QVariant rotationVar = index.data(m_rotationRole);
-                    float rotation;
-                    if (m_haveRotationPattern) {
-                        rotation = rotationVar.toString()
-                                       .replace(m_rotationPattern, m_rotationReplace)
-                                       .toFloat();
-                    } else {
-                        rotation = rotationVar.toFloat();
-                    }
-                    newProxyRow[j].setRotation(rotation);
-                }
-            }
-        }
         // Generate labels from headers if using model rows/columns
-        for (int i = 0; i < rowCount; i++)
-            rowLabels << m_itemModel->headerData(i, Qt::Vertical).toString();
-        for (int i = 0; i < columnCount; i++)
-            columnLabels << m_itemModel->headerData(i, Qt::Horizontal).toString();
-        m_columnCount = columnCount;
+        for (int i = 0; i < job.rowCount; i++)
+            job.rowLabels << m_itemModel->headerData(i, Qt::Vertical).toString();
+        for (int i = 0; i < job.columnCount; i++)
+            job.columnLabels << m_itemModel->headerData(i, Qt::Horizontal).toString();
     } else {
-        int rowRole = roleHash.key(m_proxy->rowRole().toLatin1());
-        int columnRole = roleHash.key(m_proxy->columnRole().toLatin1());
-
-        bool generateRows = m_proxy->autoRowCategories();
-        bool generateColumns = m_proxy->autoColumnCategories();
-        QStringList rowList;
-        QStringList columnList;
-        // For detecting duplicates in categories generation, using QHashes should
-        // be faster than simple QStringList::contains() check.
-        QHash<QString, bool> rowListHash;
-        QHash<QString, bool> columnListHash;
-
-        // Sort values into rows and columns
-        typedef QHash<QString, float> ColumnValueMap;
-        QHash<QString, ColumnValueMap> itemValueMap;
-        QHash<QString, ColumnValueMap> itemRotationMap;
-
-        bool cumulative = m_proxy->multiMatchBehavior()
-                              == QItemModelBarDataProxy::MultiMatchBehavior::Average
-                          || m_proxy->multiMatchBehavior()
-                                 == QItemModelBarDataProxy::MultiMatchBehavior::Cumulative;
-        bool countMatches = m_proxy->multiMatchBehavior()
-                            == QItemModelBarDataProxy::MultiMatchBehavior::Average;
-        bool takeFirst = m_proxy->multiMatchBehavior()
-                         == QItemModelBarDataProxy::MultiMatchBehavior::First;
-        QHash<QString, QHash<QString, int>> *matchCountMap = 0;
-        if (countMatches)
-            matchCountMap = new QHash<QString, QHash<QString, int>>;
-
-        for (int i = 0; i < rowCount; i++) {
-            for (int j = 0; j < columnCount; j++) {
-                QModelIndex index = m_itemModel->index(i, j);
-                QString rowRoleStr = index.data(rowRole).toString();
-                if (haveRowPattern)
-                    rowRoleStr.replace(rowPattern, rowReplace);
-                QString columnRoleStr = index.data(columnRole).toString();
-                if (haveColPattern)
-                    columnRoleStr.replace(colPattern, colReplace);
-                QVariant valueVar = index.data(m_valueRole);
-                float value;
-                if (m_haveValuePattern)
-                    value = valueVar.toString().replace(m_valuePattern, m_valueReplace).toFloat();
-                else
-                    value = valueVar.toFloat();
-                if (countMatches)
-                    (*matchCountMap)[rowRoleStr][columnRoleStr]++;
-
-                if (cumulative) {
-                    itemValueMap[rowRoleStr][columnRoleStr] += value;
-                } else {
-                    if (takeFirst && itemValueMap.contains(rowRoleStr)) {
-                        if (itemValueMap.value(rowRoleStr).contains(columnRoleStr))
-                            continue; // We already have a value for this row/column combo
-                    }
-                    itemValueMap[rowRoleStr][columnRoleStr] = value;
-                }
+        m_rowRole = roleHash.key(m_proxy->rowRole().toLatin1());
+        m_columnRole = roleHash.key(m_proxy->columnRole().toLatin1());
+        setFetchRoles({m_rowRole, m_columnRole, m_valueRole, m_rotationRole});
 
-                if (m_rotationRole != noRoleIndex) {
-                    QVariant rotationVar = index.data(m_rotationRole);
-                    float rotation;
-                    if (m_haveRotationPattern) {
-                        rotation = rotationVar.toString()
-                                       .replace(m_rotationPattern, m_rotationReplace)
-                                       .toFloat();
-                    } else {
-                        rotation = rotationVar.toFloat();
-                    }
-                    if (cumulative) {
-                        itemRotationMap[rowRoleStr][columnRoleStr] += rotation;
-                    } else {
-                        // We know we are in take last mode if we get here,
-                        // as take first mode skips to next loop already earlier
-                        itemRotationMap[rowRoleStr][columnRoleStr] = rotation;
-                    }
-                }
-                if (generateRows && !rowListHash.value(rowRoleStr, false)) {
-                    rowListHash.insert(rowRoleStr, true);
-                    rowList << rowRoleStr;
-                }
-                if (generateColumns && !columnListHash.value(columnRoleStr, false)) {
-                    columnListHash.insert(columnRoleStr, true);
-                    columnList << columnRoleStr;
-                }
-            }
-        }
-
-        if (generateRows)
-            m_proxy->d_func()->m_rowCategories = rowList;
-        else
-            rowList = m_proxy->rowCategories();
-
-        if (generateColumns)
-            m_proxy->d_func()->m_columnCategories = columnList;
-        else
-            columnList = m_proxy->columnCategories();
+        job.generateRows = m_proxy->autoRowCategories();
+        job.generateColumns = m_proxy->autoColumnCategories();
+        if (!job.generateRows)
+            job.rowCategories = m_proxy->rowCategories();
+        if (!job.generateColumns)
+            job.columnCategories = m_proxy->columnCategories();
+        job.multiMatchBehavior = m_proxy->multiMatchBehavior();
+        job.rowLabels = m_proxy->series()->rowLabels();
+        job.columnLabels = m_proxy->series()->columnLabels();
+    }
+    job.valueExtractor = m_valueExtractor;
+    job.rotationExtractor = m_rotationExtractor;
+    job.rowExtractor = m_rowExtractor;
+    job.columnExtractor = m_columnExtractor;
+    job.valueRole = m_valueRole;
+    job.rotationRole = m_rotationRole;
+    job.rowRole = m_rowRole;
+    job.columnRole = m_columnRole;
 
-        // If dimensions have changed, recreate the array
-        if (m_proxyArray.data() != m_proxy->series()->dataArray().data()
-            || columnList.size() != m_columnCount || rowList.size() != m_proxyArray.size()) {
-            m_proxyArray.clear();
-            m_proxyArray.reserve(rowList.size());
-            for (int i = 0; i < rowList.size(); i++)
-                m_proxyArray.append(QBarDataRow(columnList.size()));
-        }
-        // Create new data array from itemValueMap
-        for (int i = 0; i < rowList.size(); i++) {
-            QString rowKey = rowList.at(i);
-            QBarDataRow &newProxyRow = m_proxyArray[i];
-            for (int j = 0; j < columnList.size(); j++) {
-                float value = itemValueMap[rowKey][columnList.at(j)];
-                if (countMatches)
-                    value /= float((*matchCountMap)[rowKey][columnList.at(j)]);
-                newProxyRow[j].setValue(value);
-                if (m_rotationRole != noRoleIndex) {
-                    float angle = itemRotationMap[rowKey][columnList.at(j)];
-                    if (countMatches)
-                        angle /= float((*matchCountMap)[rowKey][columnList.at(j)]);
-                    newProxyRow[j].setRotation(angle);
-                }
+    if (m_proxy->resolveInBackground()) {
+        // The model can only be accessed on this thread, so copy its data for the worker
+        const qsizetype roleCount = m_fetchRoleData.size();
+        QList<QModelRoleData> snapshot;
+        snapshot.reserve(qsizetype(job.rowCount) * job.columnCount * roleCount);
+        for (int i = 0; i < job.rowCount; i++) {
+            for (int j = 0; j < job.columnCount; j++) {
+                for (const QModelRoleData &data : fetchRoles(m_itemModel->index(i, j)))
+                    snapshot.append(data);
             }
         }
 
-        if (!m_proxy->series()->rowLabels().isEmpty())
-            rowLabels = m_proxy->series()->rowLabels();
-        else
-            rowLabels = rowList;
-        if (!m_proxy->series()->columnLabels().isEmpty())
-            columnLabels = m_proxy->series()->columnLabels();
-        else
-            columnLabels = columnList;
-
-        m_columnCount = columnList.size();
-
-        delete matchCountMap;
+        auto promise = std::make_shared<QPromise<ResolveJob>>();
+        m_resolveWatcher.setFuture(promise->future());
+        m_resolving = true;
+        QThreadPool::globalInstance()->start(
+            [promise, job = std::move(job), snapshot = std::move(snapshot), roleCount]() mutable {
+                promise->start();
+                auto fetch = [&](int row, int column) {
+                    const qsizetype index = qsizetype(row) * job.columnCount + column;
+                    return QModelRoleDataSpan(snapshot.data() + index * roleCount, roleCount);
+                };
+                if (buildArray(job, fetch, [&]() { return promise->isCanceled(); }))
+                    promise->addResult(std::move(job));
+                promise->finish();
+            });
+    } else {
+        // Reuse the array if the series still has it
+        if (m_proxyArray.data() == m_proxy->series()->dataArray().data())
+            job.array = std::move(m_proxyArray);
+        buildArray(
+            job,
+            [this](int row, int column) { return fetchRoles(m_itemModel->index(row, column)); },
+            []() { return false; });
+        applyResolveJob(job);
     }
-
-    m_proxy->resetArray(m_proxyArray, rowLabels, columnLabels);
 }
 
 QT_END_NAMESPACE
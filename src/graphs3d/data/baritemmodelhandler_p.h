@@ -16,6 +16,7 @@
 
 #include "abstractitemmodelhandler_p.h"
 #include "qitemmodelbardataproxy_p.h"
+#include <QtCore/QFutureWatcher>
 
 QT_BEGIN_NAMESPACE
 
@@ -34,17 +35,78 @@ public Q_SLOTS:
 protected:
     void resolveModel() override;
 
+private Q_SLOTS:
+    void handleResolveFinished();
+
+private:
+    // Everything needed to build the data array from the model data. It is filled on the
+    // GUI thread, so that the array can also be built on a worker thread.
+    struct ResolveJob
+    {
+        RoleExtractor valueExtractor;
+        RoleExtractor rotationExtractor;
+        RoleExtractor rowExtractor;
+        RoleExtractor columnExtractor;
+        int valueRole = -1;
+        int rotationRole = -1;
+        int rowRole = -1;
+        int columnRole = -1;
+        int rowCount = 0;
+        int columnCount = 0;
+        bool useModelCategories = false;
+        bool generateRows = false;
+        bool generateColumns = false;
+        QItemModelBarDataProxy::MultiMatchBehavior multiMatchBehavior
+            = QItemModelBarDataProxy::MultiMatchBehavior::Last;
+        // Header labels with model categories, otherwise the labels of the series.
+        // Empty series labels are replaced with the categories.
+        QStringList rowLabels;
+        QStringList columnLabels;
+        QStringList rowCategories;
+        QStringList columnCategories;
+        QBarDataArray array;
+        qsizetype arrayColumnCount = 0;
+        // Bookkeeping for role mapped models, see the members of the same name
+        QList<int> indexCells;
+        QList<float> indexValues;
+        QList<float> indexRotations;
+        QList<qsizetype> cellSources;
+        QList<int> cellMatchCounts;
+    };
+
+    template<typename Fetch, typename Canceled>
+    static bool buildArray(ResolveJob &job, Fetch fetch, Canceled canceled);
+    void applyResolveJob(ResolveJob &job);
+
+protected:
     QItemModelBarDataProxy *m_proxy; // Not owned
     QBarDataArray m_proxyArray;
     qsizetype m_columnCount;
     int m_valueRole;
     int m_rotationRole;
-    QRegularExpression m_valuePattern;
-    QRegularExpression m_rotationPattern;
-    QString m_valueReplace;
-    QString m_rotationReplace;
-    bool m_haveValuePattern;
-    bool m_haveRotationPattern;
+    int m_rowRole;
+    int m_columnRole;
+    RoleExtractor m_valueExtractor;
+    RoleExtractor m_rotationExtractor;
+    RoleExtractor m_rowExtractor;
+    RoleExtractor m_columnExtractor;
+
+    // Bookkeeping for role mapped models, indexed by row * columnCount + column of the model.
+    // Cells are indexed by row * m_columnCount + column of the proxy.
+    QList<int> m_indexCells;
+    QList<float> m_indexValues;
+    QList<float> m_indexRotations;
+    QList<qsizetype> m_cellSources;
+    QList<int> m_cellMatchCounts;
+    QFutureWatcher<ResolveJob> m_resolveWatcher;
+    bool m_resolving;
+    bool m_resolveAgain;
+
+private:
+    float readValue(const QModelRoleDataSpan &data) const;
+    float readRotation(const QModelRoleDataSpan &data) const;
+    bool updateRoleMappedItems(int startRow, int endRow, int startColumn, int endColumn);
+    void clearRoleMapping();
 };
 
 QT_END_NAMESPACE
@@ -5,6 +5,18 @@
 
 QT_BEGIN_NAMESPACE
 
+static int texelBytes(QImage::Format format)
+{
+    switch (format) {
+    case QImage::Format_Indexed8:
+        return 1;
+    case QImage::Format_Grayscale16:
+        return 2;
+    default:
+        return 4;
+    }
+}
+
 /*!
  * \class QCustom3DVolume
  * \inmodule QtGraphs
@@ -143,6 +155,31 @@ QT_BEGIN_NAMESPACE
  * \sa alphaMultiplier
  */
 
+/*!
+ * \qmlproperty real Custom3DVolume::windowLevel
+ * \since 6.10
+ *
+ * The center of the value window that is mapped onto the color table of a
+ * scalar volume. The value is a fraction of the full value range of the texture
+ * format, so \c{0.0} is the smallest and \c{1.0} the largest representable
+ * value. Values below the window use the first color of the color table and
+ * values above it use the last color. Only affects volumes whose texture format
+ * uses colorTable. Defaults to \c{0.5}.
+ *
+ * \sa windowWidth
+ */
+
+/*!
+ * \qmlproperty real Custom3DVolume::windowWidth
+ * \since 6.10
+ *
+ * The width of the value window that is mapped onto the color table of a
+ * scalar volume, as a fraction of the full value range of the texture format.
+ * The value must be greater than zero. Defaults to \c{1.0}.
+ *
+ * \sa windowLevel
+ */
+
 /*!
  * \qmlproperty bool Custom3DVolume::useHighDefShader
  *
@@ -284,6 +321,20 @@ QT_BEGIN_NAMESPACE
     This signal is emitted when preserveOpacity changes to \a enabled.
 */
 
+/*!
+    \qmlsignal Custom3DVolume::windowLevelChanged(real level)
+    \since 6.10
+
+    This signal is emitted when windowLevel changes to \a level.
+*/
+
+/*!
+    \qmlsignal Custom3DVolume::windowWidthChanged(real width)
+    \since 6.10
+
+    This signal is emitted when windowWidth changes to \a width.
+*/
+
 /*!
     \qmlsignal Custom3DVolume::useHighDefShaderChanged(bool enabled)
 
@@ -483,7 +534,9 @@ void QCustom3DVolume::setTextureDimensions(int width, int height, int depth)
 /*!
  * Returns the actual texture data width. When the texture format is
  * QImage::Format_Indexed8, this value equals textureWidth aligned to a 32-bit
- * boundary. Otherwise, this value equals four times textureWidth.
+ * boundary. When the texture format is QImage::Format_Grayscale16, this value
+ * equals two times textureWidth aligned to a 32-bit boundary. Otherwise, this
+ * value equals four times textureWidth.
  */
 int QCustom3DVolume::textureDataWidth() const
 {
@@ -492,6 +545,8 @@ int QCustom3DVolume::textureDataWidth() const
 
     if (d->m_textureFormat == QImage::Format_Indexed8)
         dataWidth += dataWidth % 4;
+    else if (d->m_textureFormat == QImage::Format_Grayscale16)
+        dataWidth = (dataWidth + dataWidth % 2) * 2;
     else
         dataWidth *= 4;
 
@@ -603,10 +658,14 @@ void QCustom3DVolume::setSliceIndices(int x, int y, int z)
 
 /*! \property QCustom3DVolume::colorTable
  *
- * \brief The array containing the colors for indexed texture formats.
+ * \brief The array containing the colors for indexed and grayscale texture
+ * formats.
  *
- * If the texture format is not indexed, this array is not used and can be
- * empty.
+ * For QImage::Format_Grayscale16, the array acts as a transfer function: the
+ * windowed scalar value of each texel selects a color from the array, with the
+ * first color used for the bottom of the window and the last color for the top.
+ * If the texture format is QImage::Format_ARGB32, this array is not used and
+ * can be empty.
  *
  * Defaults to \c{0}.
  *
@@ -652,8 +711,9 @@ QList<QRgb> QCustom3DVolume::colorTable() const
  *
  * \note Each x-dimension line of the data needs to be 32-bit aligned.
  * If textureFormat is QImage::Format_Indexed8 and the textureWidth value is not
- * divisible by four, padding bytes might need to be added to each x-dimension
- * line of the \a data. The textureDataWidth() function returns the padded byte
+ * divisible by four, or textureFormat is QImage::Format_Grayscale16 and the
+ * textureWidth value is odd, padding bytes might need to be added to each
+ * x-dimension line of the \a data. The textureDataWidth() function returns the padded byte
  * count. The padding bytes should indicate a fully transparent color to avoid
  * rendering artifacts.
  *
@@ -670,6 +730,7 @@ void QCustom3DVolume::setTextureData(QList<uchar> *data)
     // Even if the pointer is same as previously, consider this property changed,
     // as the values can be changed unbeknownst to us via the array pointer.
     d->m_textureData = data;
+    d->m_wholeTextureDirty = true;
     d->m_dirtyBitsVolume.textureDataDirty = true;
     emit textureDataChanged(data);
     emit needUpdate();
@@ -680,9 +741,11 @@ void QCustom3DVolume::setTextureData(QList<uchar> *data)
  * textureData for this volume object. The texture dimensions are also set
  * according to image and array dimensions. All of the images in the array must
  * be the same size. If the images are not all in the QImage::Format_Indexed8
- * format, all texture data will be converted into the QImage::Format_ARGB32
- * format. If the images are in the QImage::Format_Indexed8 format, the
- * colorTable value for the entire volume will be taken from the first image.
+ * format or all in the QImage::Format_Grayscale16 format, all texture data will
+ * be converted into the QImage::Format_ARGB32 format. If the images are in the
+ * QImage::Format_Indexed8 format, the colorTable value for the entire volume
+ * will be taken from the first image. Images in the QImage::Format_Grayscale16
+ * format do not have a color table, so colorTable must be set separately.
  *
  * Returns a pointer to the newly created array.
  *
@@ -699,7 +762,8 @@ QList<uchar> *QCustom3DVolume::createTextureData(const QList<QImage *> &images)
         int imageHeight = currentImage->height();
         QImage::Format imageFormat = currentImage->format();
         bool convert = false;
-        if (imageFormat != QImage::Format_Indexed8 && imageFormat != QImage::Format_ARGB32) {
+        if (imageFormat != QImage::Format_Indexed8 && imageFormat != QImage::Format_Grayscale16
+            && imageFormat != QImage::Format_ARGB32) {
             convert = true;
             imageFormat = QImage::Format_ARGB32;
         } else {
@@ -721,10 +785,9 @@ QList<uchar> *QCustom3DVolume::createTextureData(const QList<QImage *> &images)
                 }
             }
         }
-        int colorBytes = (imageFormat == QImage::Format_Indexed8) ? 1 : 4;
-        qsizetype imageByteWidth = (imageFormat == QImage::Format_Indexed8) ? currentImage->bytesPerLine()
-                                                                            : imageWidth;
-        qsizetype frameSize = imageByteWidth * imageHeight * colorBytes;
+        qsizetype frameSize = (imageFormat == QImage::Format_ARGB32)
+                                  ? qsizetype(imageWidth) * imageHeight * 4
+                                  : currentImage->bytesPerLine() * imageHeight;
         QList<uchar> *newTextureData = new QList<uchar>;
         newTextureData->resize(frameSize * imageCount);
         uchar *texturePtr = newTextureData->data();
@@ -775,8 +838,10 @@ QList<uchar> *QCustom3DVolume::textureData() const
  *
  * \note Each x-dimension line of the data needs to be 32-bit aligned when
  * targeting the y-axis or z-axis. If textureFormat is QImage::Format_Indexed8
- * and the textureWidth value is not divisible by four, padding bytes might need
- * to be added to each x-dimension line of the \a data to properly align it. The
+ * and the textureWidth value is not divisible by four, or textureFormat is
+ * QImage::Format_Grayscale16 and the textureWidth value is odd, padding bytes
+ * might need to be added to each x-dimension line of the \a data to properly
+ * align it. The
  * padding bytes should indicate a fully transparent color to avoid rendering
  * artifacts.
  *
@@ -789,7 +854,7 @@ void QCustom3DVolume::setSubTextureData(Qt::Axis axis, int index, const uchar *d
         int lineSize = textureDataWidth();
         int frameSize = lineSize * d->m_textureHeight;
         qsizetype dataSize = d->m_textureData->size();
-        int pixelWidth = (d->m_textureFormat == QImage::Format_Indexed8) ? 1 : 4;
+        int pixelWidth = texelBytes(d->m_textureFormat);
         int targetIndex;
         uchar *dataPtr = d->m_textureData->data();
         bool invalid = (index < 0);
@@ -837,6 +902,7 @@ void QCustom3DVolume::setSubTextureData(Qt::Axis axis, int index, const uchar *d
                 void *subTexPtr = dataPtr + targetIndex;
                 memcpy(subTexPtr, static_cast<const void *>(data), frameSize);
             }
+            d->markSubTextureDirty(axis, index);
             d->m_dirtyBitsVolume.textureDataDirty = true;
             emit textureDataChanged(d->m_textureData);
             emit needUpdate();
@@ -903,17 +969,25 @@ void QCustom3DVolume::setSubTextureData(Qt::Axis axis, int index, const QImage &
 // Qt 5.2.1 at least has this problem.
 
 /*!
- * Sets the format of the textureData property to \a format. Only two formats
+ * Sets the format of the textureData property to \a format. Only three formats
  * are supported currently:
- * QImage::Format_Indexed8 and QImage::Format_ARGB32. If an indexed format is
- * specified, colorTable must also be set. Defaults to QImage::Format_ARGB32.
+ * QImage::Format_Indexed8, QImage::Format_Grayscale16, and
+ * QImage::Format_ARGB32. If an indexed or a grayscale format is specified,
+ * colorTable must also be set.
  *
- * \sa colorTable, textureData
+ * With QImage::Format_Grayscale16, each texel is a single 16-bit scalar value
+ * that is kept in that form on the GPU. The value is mapped onto colorTable
+ * through the window defined by windowLevel and windowWidth when the volume is
+ * rendered, so changing the window does not require the texture data to be
+ * uploaded again. Defaults to QImage::Format_ARGB32.
+ *
+ * \sa colorTable, textureData, windowLevel, windowWidth
  */
 void QCustom3DVolume::setTextureFormat(QImage::Format format)
 {
     Q_D(QCustom3DVolume);
-    if (format == QImage::Format_ARGB32 || format == QImage::Format_Indexed8) {
+    if (format == QImage::Format_ARGB32 || format == QImage::Format_Indexed8
+        || format == QImage::Format_Grayscale16) {
         if (d->m_textureFormat != format) {
             d->m_textureFormat = format;
             d->m_dirtyBitsVolume.textureFormatDirty = true;
@@ -980,6 +1054,73 @@ float QCustom3DVolume::alphaMultiplier() const
     return d->m_alphaMultiplier;
 }
 
+/*!
+ * \property QCustom3DVolume::windowLevel
+ * \since 6.10
+ *
+ * \brief The center of the value window that is mapped onto the color table of
+ * a scalar volume.
+ *
+ * The value is a fraction of the full value range of the texture format, so
+ * \c{0.0} is the smallest and \c{1.0} the largest representable value. Values
+ * below the window use the first color of colorTable and values above it use
+ * the last color. Only affects volumes whose textureFormat uses colorTable.
+ * The window is applied on the GPU, so changing it does not cause the texture
+ * data to be uploaded again. Defaults to \c{0.5f}.
+ *
+ * \sa windowWidth, setTextureFormat()
+ */
+void QCustom3DVolume::setWindowLevel(float level)
+{
+    Q_D(QCustom3DVolume);
+    if (d->m_windowLevel != level) {
+        d->m_windowLevel = level;
+        d->m_dirtyBitsVolume.windowDirty = true;
+        emit windowLevelChanged(level);
+        emit needUpdate();
+    }
+}
+
+float QCustom3DVolume::windowLevel() const
+{
+    Q_D(const QCustom3DVolume);
+    return d->m_windowLevel;
+}
+
+/*!
+ * \property QCustom3DVolume::windowWidth
+ * \since 6.10
+ *
+ * \brief The width of the value window that is mapped onto the color table of
+ * a scalar volume.
+ *
+ * The value is a fraction of the full value range of the texture format and
+ * must be greater than zero. Defaults to \c{1.0f}.
+ *
+ * \sa windowLevel
+ */
+void QCustom3DVolume::setWindowWidth(float width)
+{
+    Q_D(QCustom3DVolume);
+    if (width > 0.0f) {
+        if (d->m_windowWidth != width) {
+            d->m_windowWidth = width;
+            d->m_dirtyBitsVolume.windowDirty = true;
+            emit windowWidthChanged(width);
+            emit needUpdate();
+        }
+    } else {
+        qWarning("%ls Attempted to set non-positive window width.",
+                 qUtf16Printable(QString::fromUtf8(__func__)));
+    }
+}
+
+float QCustom3DVolume::windowWidth() const
+{
+    Q_D(const QCustom3DVolume);
+    return d->m_windowWidth;
+}
+
 /*!
  * \property QCustom3DVolume::preserveOpacity
  *
@@ -1264,8 +1405,11 @@ QCustom3DVolumePrivate::QCustom3DVolumePrivate()
     , m_sliceIndexZ(-1)
     , m_textureFormat(QImage::Format_ARGB32)
     , m_textureData(0)
+    , m_wholeTextureDirty(true)
     , m_alphaMultiplier(1.0f)
     , m_preserveOpacity(true)
+    , m_windowLevel(0.5f)
+    , m_windowWidth(1.0f)
     , m_useHighDefShader(true)
     , m_drawSlices(false)
     , m_drawSliceFrames(false)
@@ -1300,8 +1444,11 @@ QCustom3DVolumePrivate::QCustom3DVolumePrivate(QVector3D position,
     , m_textureFormat(textureFormat)
     , m_colorTable(colorTable)
     , m_textureData(textureData)
+    , m_wholeTextureDirty(true)
     , m_alphaMultiplier(1.0f)
     , m_preserveOpacity(true)
+    , m_windowLevel(0.5f)
+    , m_windowWidth(1.0f)
     , m_useHighDefShader(true)
     , m_drawSlices(false)
     , m_drawSliceFrames(false)
@@ -1320,7 +1467,7 @@ QCustom3DVolumePrivate::QCustom3DVolumePrivate(QVector3D position,
     if (m_textureDepth < 0)
         m_textureDepth = 0;
 
-    if (m_textureFormat != QImage::Format_Indexed8)
+    if (m_textureFormat != QImage::Format_Indexed8 && m_textureFormat != QImage::Format_Grayscale16)
         m_textureFormat = QImage::Format_ARGB32;
 }
 
@@ -1339,9 +1486,47 @@ void QCustom3DVolumePrivate::resetDirtyBits()
     m_dirtyBitsVolume.textureDataDirty = false;
     m_dirtyBitsVolume.textureFormatDirty = false;
     m_dirtyBitsVolume.alphaDirty = false;
+    m_dirtyBitsVolume.windowDirty = false;
     m_dirtyBitsVolume.shaderDirty = false;
 }
 
+void QCustomVolumeTextureBox::unite(const QCustomVolumeTextureBox &other)
+{
+    if (other.isEmpty())
+        return;
+    if (isEmpty()) {
+        *this = other;
+        return;
+    }
+    for (int i = 0; i < 3; ++i) {
+        from[i] = qMin(from[i], other.from[i]);
+        to[i] = qMax(to[i], other.to[i]);
+    }
+}
+
+void QCustom3DVolumePrivate::markSubTextureDirty(Qt::Axis axis, int index)
+{
+    const int axisIndex = axis == Qt::XAxis ? 0 : axis == Qt::YAxis ? 1 : 2;
+    QCustomVolumeTextureBox slice;
+    slice.to[0] = m_textureWidth;
+    slice.to[1] = m_textureHeight;
+    slice.to[2] = m_textureDepth;
+    slice.from[axisIndex] = index;
+    slice.to[axisIndex] = index + 1;
+    m_dirtyTextureBox.unite(slice);
+}
+
+// Returns the texels written since the previous call. wholeTexture is set if the data
+// was replaced meanwhile, in which case the box does not cover all the changes.
+QCustomVolumeTextureBox QCustom3DVolumePrivate::takeDirtyTextureBox(bool *wholeTexture)
+{
+    *wholeTexture = m_wholeTextureDirty;
+    m_wholeTextureDirty = false;
+    const QCustomVolumeTextureBox box = m_dirtyTextureBox;
+    m_dirtyTextureBox = QCustomVolumeTextureBox();
+    return box;
+}
+
 QImage QCustom3DVolumePrivate::renderSlice(Qt::Axis axis, int index)
 {
     Q_Q(QCustom3DVolume);
@@ -1368,12 +1553,12 @@ QImage QCustom3DVolumePrivate::renderSlice(Qt::Axis axis, int index)
     }
 
     int padding = 0;
-    int pixelWidth = 4;
+    int pixelWidth = texelBytes(m_textureFormat);
     int dataWidth = q->textureDataWidth();
-    if (m_textureFormat == QImage::Format_Indexed8) {
+    if (m_textureFormat == QImage::Format_Indexed8)
         padding = x % 4;
-        pixelWidth = 1;
-    }
+    else if (m_textureFormat == QImage::Format_Grayscale16)
+        padding = x % 2;
     QList<uchar> data((x + padding) * y * pixelWidth);
     int frameSize = q->textureDataWidth() * m_textureHeight;
 
@@ -1405,7 +1590,7 @@ QImage QCustom3DVolumePrivate::renderSlice(Qt::Axis axis, int index)
         }
     }
 
-    if (m_textureFormat != QImage::Format_Indexed8 && m_alphaMultiplier != 1.0f) {
+    if (m_textureFormat == QImage::Format_ARGB32 && m_alphaMultiplier != 1.0f) {
         for (int i = pixelWidth - 1; i < data.size(); i += pixelWidth)
             data[i] = static_cast<uchar>(multipliedAlphaValue(data.at(i)));
     }
@@ -34,6 +34,10 @@ class Q_GRAPHS_EXPORT QCustom3DVolume : public QCustom3DItem
                    alphaMultiplierChanged FINAL)
     Q_PROPERTY(bool preserveOpacity READ preserveOpacity WRITE setPreserveOpacity NOTIFY
                    preserveOpacityChanged FINAL)
+    Q_PROPERTY(float windowLevel READ windowLevel WRITE setWindowLevel NOTIFY windowLevelChanged
+                   REVISION(6, 10) FINAL)
+    Q_PROPERTY(float windowWidth READ windowWidth WRITE setWindowWidth NOTIFY windowWidthChanged
+                   REVISION(6, 10) FINAL)
     Q_PROPERTY(bool useHighDefShader READ useHighDefShader WRITE setUseHighDefShader NOTIFY
                    useHighDefShaderChanged FINAL)
     Q_PROPERTY(bool drawSlices READ drawSlices WRITE setDrawSlices NOTIFY drawSlicesChanged FINAL)
@@ -97,6 +101,11 @@ public:
     void setPreserveOpacity(bool enable);
     bool preserveOpacity() const;
 
+    void setWindowLevel(float level);
+    float windowLevel() const;
+    void setWindowWidth(float width);
+    float windowWidth() const;
+
     void setUseHighDefShader(bool enable);
     bool useHighDefShader() const;
 
@@ -128,6 +137,8 @@ Q_SIGNALS:
     void textureFormatChanged(QImage::Format format);
     void alphaMultiplierChanged(float mult);
     void preserveOpacityChanged(bool enabled);
+    Q_REVISION(6, 10) void windowLevelChanged(float level);
+    Q_REVISION(6, 10) void windowWidthChanged(float width);
     void useHighDefShaderChanged(bool enabled);
     void drawSlicesChanged(bool enabled);
     void drawSliceFramesChanged(bool enabled);
@@ -138,6 +149,8 @@ Q_SIGNALS:
 
 private:
     Q_DISABLE_COPY(QCustom3DVolume)
+
+    friend class QQuickGraphsItem;
 };
 
 QT_END_NAMESPACE
@@ -27,6 +27,7 @@ struct QCustomVolumeDirtyBitField
     bool textureDataDirty : 1;
     bool textureFormatDirty : 1;
     bool alphaDirty : 1;
+    bool windowDirty : 1;
     bool shaderDirty : 1;
 
     QCustomVolumeDirtyBitField()
@@ -36,10 +37,21 @@ struct QCustomVolumeDirtyBitField
         , textureDataDirty(false)
         , textureFormatDirty(false)
         , alphaDirty(false)
+        , windowDirty(false)
         , shaderDirty(false)
     {}
 };
 
+// Texel box of a volume texture, [from, to) on the x, y and z axes
+struct QCustomVolumeTextureBox
+{
+    int from[3] = {0, 0, 0};
+    int to[3] = {0, 0, 0};
+
+    bool isEmpty() const { return from[0] >= to[0] || from[1] >= to[1] || from[2] >= to[2]; }
+    void unite(const QCustomVolumeTextureBox &other);
+};
+
 class QCustom3DVolumePrivate : public QCustom3DItemPrivate
 {
     Q_DECLARE_PUBLIC(QCustom3DVolume)
@@ -59,6 +71,8 @@ public:
 
     void resetDirtyBits();
     QImage renderSlice(Qt::Axis axis, int index);
+    void markSubTextureDirty(Qt::Axis axis, int index);
+    QCustomVolumeTextureBox takeDirtyTextureBox(bool *wholeTexture);
 
 public:
     int m_textureWidth;
@@ -71,9 +85,15 @@ public:
     QImage::Format m_textureFormat;
     QList<QRgb> m_colorTable;
     QList<uchar> *m_textureData;
+    // Texels written by setSubTextureData() since the renderer last took them. Replacing
+    // the data marks the whole texture dirty instead.
+    QCustomVolumeTextureBox m_dirtyTextureBox;
+    bool m_wholeTextureDirty;
 
     float m_alphaMultiplier;
     bool m_preserveOpacity;
+    float m_windowLevel;
+    float m_windowWidth;
     bool m_useHighDefShader;
 
     bool m_drawSlices;
@@ -253,6 +253,19 @@ QT_BEGIN_NAMESPACE
  * {ItemModelBarDataProxy.MultiMatchBehavior.Cumulative}.
  */
 
+/*!
+ * \qmlproperty bool ItemModelBarDataProxy::resolveInBackground
+ * \since 6.10
+ *
+ * Whether the whole item model is resolved on a worker thread. If \c{true},
+ * the data of the model is copied on the GUI thread, and it is parsed into the
+ * bar data array in a thread pool. The finished array replaces the previous
+ * one in a single array reset, so large models do not stall rendering and
+ * input while they are being resolved. Single item changes made while the
+ * model is not being resolved are still applied directly.
+ * Defaults to \c{false}.
+ */
+
 /*!
     \qmlsignal ItemModelBarDataProxy::itemModelChanged(model itemModel)
 
@@ -349,6 +362,13 @@ QT_BEGIN_NAMESPACE
     This signal is emitted when multiMatchBehavior changes to \a behavior.
 */
 
+/*!
+    \qmlsignal ItemModelBarDataProxy::resolveInBackgroundChanged(bool enable)
+    \since 6.10
+
+    This signal is emitted when resolveInBackground changes to \a enable.
+*/
+
 /*!
  *  \enum QItemModelBarDataProxy::MultiMatchBehavior
  *
@@ -1023,6 +1043,35 @@ QItemModelBarDataProxy::MultiMatchBehavior QItemModelBarDataProxy::multiMatchBeh
     return d->m_multiMatchBehavior;
 }
 
+/*!
+ * \property QItemModelBarDataProxy::resolveInBackground
+ * \since 6.10
+ *
+ * \brief Whether the whole item model is resolved on a worker thread.
+ *
+ * If this property value is \c{true}, the data of the item model is copied on
+ * the GUI thread, and the role patterns, multiMatchBehavior and categories are applied to it in QThreadPool::globalInstance().
+ * The finished array replaces the previous one with a single arrayReset(), so
+ * resolving large models does not stall rendering and input. If the model
+ * changes while it is being resolved, the pending result is still applied, and
+ * the model is resolved once more after it.
+ * Defaults to \c{false}.
+ */
+void QItemModelBarDataProxy::setResolveInBackground(bool enable)
+{
+    Q_D(QItemModelBarDataProxy);
+    if (d->m_resolveInBackground != enable) {
+        d->m_resolveInBackground = enable;
+        emit resolveInBackgroundChanged(enable);
+    }
+}
+
+bool QItemModelBarDataProxy::resolveInBackground() const
+{
+    Q_D(const QItemModelBarDataProxy);
+    return d->m_resolveInBackground;
+}
+
 // QItemModelBarDataProxyPrivate
 
 QItemModelBarDataProxyPrivate::QItemModelBarDataProxyPrivate(QItemModelBarDataProxy *q)
@@ -1031,6 +1080,7 @@ QItemModelBarDataProxyPrivate::QItemModelBarDataProxyPrivate(QItemModelBarDataPr
     , m_autoRowCategories(true)
     , m_autoColumnCategories(true)
     , m_multiMatchBehavior(QItemModelBarDataProxy::MultiMatchBehavior::Last)
+    , m_resolveInBackground(false)
 {}
 
 QItemModelBarDataProxyPrivate::~QItemModelBarDataProxyPrivate()
@@ -52,6 +52,8 @@ class Q_GRAPHS_EXPORT QItemModelBarDataProxy : public QBarDataProxy
                    NOTIFY rotationRoleReplaceChanged FINAL)
     Q_PROPERTY(QItemModelBarDataProxy::MultiMatchBehavior multiMatchBehavior READ multiMatchBehavior
                    WRITE setMultiMatchBehavior NOTIFY multiMatchBehaviorChanged FINAL)
+    Q_PROPERTY(bool resolveInBackground READ resolveInBackground WRITE setResolveInBackground
+                   NOTIFY resolveInBackgroundChanged REVISION(6, 10) FINAL)
     QML_NAMED_ELEMENT(ItemModelBarDataProxy)
 
 public:
@@ -151,6 +153,9 @@ public:
     void setMultiMatchBehavior(QItemModelBarDataProxy::MultiMatchBehavior behavior);
     QItemModelBarDataProxy::MultiMatchBehavior multiMatchBehavior() const;
 
+    void setResolveInBackground(bool enable);
+    bool resolveInBackground() const;
+
 Q_SIGNALS:
     void itemModelChanged(const QAbstractItemModel *itemModel);
     void rowRoleChanged(const QString &role);
@@ -171,6 +176,7 @@ Q_SIGNALS:
     void valueRoleReplaceChanged(const QString &replace);
     void rotationRoleReplaceChanged(const QString &replace);
     void multiMatchBehaviorChanged(QItemModelBarDataProxy::MultiMatchBehavior behavior);
+    Q_REVISION(6, 10) void resolveInBackgroundChanged(bool enable);
 
 private:
     Q_DISABLE_COPY(QItemModelBarDataProxy)
@@ -60,6 +60,8 @@ private:
 
     QItemModelBarDataProxy::MultiMatchBehavior m_multiMatchBehavior;
 
+    bool m_resolveInBackground;
+
     friend class BarItemModelHandler;
 };
 
@@ -198,6 +198,19 @@ QT_BEGIN_NAMESPACE
  * \sa rotationRole, rotationRolePattern
  */
 
+/*!
+ * \qmlproperty bool ItemModelScatterDataProxy::resolveInBackground
+ * \since 6.10
+ *
+ * Whether the whole item model is resolved on a worker thread. If \c{true},
+ * the data of the model is copied on the GUI thread, and it is parsed into the
+ * scatter data array in a thread pool. The finished array replaces the previous
+ * one in a single array reset, so large models do not stall rendering and
+ * input while they are being resolved. Single item changes made while the
+ * model is not being resolved are still applied directly.
+ * Defaults to \c{false}.
+ */
+
 /*!
     \qmlsignal ItemModelScatterDataProxy::itemModelChanged(model itemModel)
 
@@ -276,6 +289,13 @@ QT_BEGIN_NAMESPACE
     This signal is emitted when zPosRoleReplace changes to \a replace.
 */
 
+/*!
+    \qmlsignal ItemModelScatterDataProxy::resolveInBackgroundChanged(bool enable)
+    \since 6.10
+
+    This signal is emitted when resolveInBackground changes to \a enable.
+*/
+
 /*!
  * Constructs QItemModelScatterDataProxy with optional \a parent.
  */
@@ -675,6 +695,35 @@ QString QItemModelScatterDataProxy::rotationRoleReplace() const
     return d->m_rotationRoleReplace;
 }
 
+/*!
+ * \property QItemModelScatterDataProxy::resolveInBackground
+ * \since 6.10
+ *
+ * \brief Whether the whole item model is resolved on a worker thread.
+ *
+ * If this property value is \c{true}, the data of the item model is copied on
+ * the GUI thread, and the role patterns are applied to it in QThreadPool::globalInstance().
+ * The finished array replaces the previous one with a single arrayReset(), so
+ * resolving large models does not stall rendering and input. If the model
+ * changes while it is being resolved, the pending result is still applied, and
+ * the model is resolved once more after it.
+ * Defaults to \c{false}.
+ */
+void QItemModelScatterDataProxy::setResolveInBackground(bool enable)
+{
+    Q_D(QItemModelScatterDataProxy);
+    if (d->m_resolveInBackground != enable) {
+        d->m_resolveInBackground = enable;
+        emit resolveInBackgroundChanged(enable);
+    }
+}
+
+bool QItemModelScatterDataProxy::resolveInBackground() const
+{
+    Q_D(const QItemModelScatterDataProxy);
+    return d->m_resolveInBackground;
+}
+
 /*!
  * Changes \a xPosRole, \a yPosRole, \a zPosRole, and \a rotationRole mapping.
  */
@@ -693,6 +742,7 @@ void QItemModelScatterDataProxy::remap(const QString &xPosRole,
 
 QItemModelScatterDataProxyPrivate::QItemModelScatterDataProxyPrivate(QItemModelScatterDataProxy *q)
     : m_itemModelHandler(new ScatterItemModelHandler(q))
+    , m_resolveInBackground(false)
 {}
 
 QItemModelScatterDataProxyPrivate::~QItemModelScatterDataProxyPrivate()
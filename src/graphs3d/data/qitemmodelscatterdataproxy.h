@@ -40,6 +40,8 @@ class Q_GRAPHS_EXPORT QItemModelScatterDataProxy : public QScatterDataProxy
                    zPosRoleReplaceChanged FINAL)
     Q_PROPERTY(QString rotationRoleReplace READ rotationRoleReplace WRITE setRotationRoleReplace
                    NOTIFY rotationRoleReplaceChanged FINAL)
+    Q_PROPERTY(bool resolveInBackground READ resolveInBackground WRITE setResolveInBackground
+                   NOTIFY resolveInBackgroundChanged REVISION(6, 10) FINAL)
     QML_NAMED_ELEMENT(ItemModelScatterDataProxy)
 
 public:
@@ -93,6 +95,9 @@ public:
     void setRotationRoleReplace(const QString &replace);
     QString rotationRoleReplace() const;
 
+    void setResolveInBackground(bool enable);
+    bool resolveInBackground() const;
+
 Q_SIGNALS:
     void itemModelChanged(const QAbstractItemModel *itemModel);
     void xPosRoleChanged(const QString &role);
@@ -107,6 +112,7 @@ Q_SIGNALS:
     void xPosRoleReplaceChanged(const QString &replace);
     void yPosRoleReplaceChanged(const QString &replace);
     void zPosRoleReplaceChanged(const QString &replace);
+    Q_REVISION(6, 10) void resolveInBackgroundChanged(bool enable);
 
 private:
     Q_DISABLE_COPY(QItemModelScatterDataProxy)
@@ -47,6 +47,8 @@ private:
     QString m_yPosRoleReplace;
     QString m_zPosRoleReplace;
     QString m_rotationRoleReplace;
+
+    bool m_resolveInBackground;
 };
 
 QT_END_NAMESPACE
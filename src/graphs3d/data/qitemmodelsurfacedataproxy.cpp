@@ -303,6 +303,19 @@ QT_BEGIN_NAMESPACE
  * {ItemModelSurfaceDataProxy.MultiMatchBehavior.Average}.
  */
 
+/*!
+ * \qmlproperty bool ItemModelSurfaceDataProxy::resolveInBackground
+ * \since 6.10
+ *
+ * Whether the whole item model is resolved on a worker thread. If \c{true},
+ * the data of the model is copied on the GUI thread, and it is parsed and
+ * sorted into the surface data array in a thread pool. The finished array
+ * replaces the previous one in a single array reset, so large models do not
+ * stall rendering and input while they are being resolved. Single item changes
+ * made while the model is not being resolved are still applied directly.
+ * Defaults to \c{false}.
+ */
+
 /*!
     \qmlsignal ItemModelSurfaceDataProxy::itemModelChanged(model itemModel)
 
@@ -435,6 +448,13 @@ QT_BEGIN_NAMESPACE
     This signal is emitted when multiMatchBehavior changes to \a behavior.
 */
 
+/*!
+    \qmlsignal ItemModelSurfaceDataProxy::resolveInBackgroundChanged(bool enable)
+    \since 6.10
+
+    This signal is emitted when resolveInBackground changes to \a enable.
+*/
+
 /*!
  *  \enum QItemModelSurfaceDataProxy::MultiMatchBehavior
  *
@@ -1216,6 +1236,36 @@ QItemModelSurfaceDataProxy::MultiMatchBehavior QItemModelSurfaceDataProxy::multi
     return d->m_multiMatchBehavior;
 }
 
+/*!
+ * \property QItemModelSurfaceDataProxy::resolveInBackground
+ * \since 6.10
+ *
+ * \brief Whether the whole item model is resolved on a worker thread.
+ *
+ * If this property value is \c{true}, the data of the item model is copied on
+ * the GUI thread, and the role patterns, multiMatchBehavior and categories are
+ * applied to it in QThreadPool::globalInstance(). The finished array replaces
+ * the previous one with a single arrayReset(), so resolving large models does
+ * not stall rendering and input. If the model changes while it is being
+ * resolved, the pending result is still applied, and the model is resolved
+ * once more after it.
+ * Defaults to \c{false}.
+ */
+void QItemModelSurfaceDataProxy::setResolveInBackground(bool enable)
+{
+    Q_D(QItemModelSurfaceDataProxy);
+    if (d->m_resolveInBackground != enable) {
+        d->m_resolveInBackground = enable;
+        emit resolveInBackgroundChanged(enable);
+    }
+}
+
+bool QItemModelSurfaceDataProxy::resolveInBackground() const
+{
+    Q_D(const QItemModelSurfaceDataProxy);
+    return d->m_resolveInBackground;
+}
+
 // QItemModelSurfaceDataProxyPrivate
 
 QItemModelSurfaceDataProxyPrivate::QItemModelSurfaceDataProxyPrivate(QItemModelSurfaceDataProxy *q)
@@ -1224,6 +1274,7 @@ QItemModelSurfaceDataProxyPrivate::QItemModelSurfaceDataProxyPrivate(QItemModelS
     , m_autoRowCategories(true)
     , m_autoColumnCategories(true)
     , m_multiMatchBehavior(QItemModelSurfaceDataProxy::MultiMatchBehavior::Last)
+    , m_resolveInBackground(false)
 {}
 
 QItemModelSurfaceDataProxyPrivate::~QItemModelSurfaceDataProxyPrivate()
@@ -58,6 +58,8 @@ class Q_GRAPHS_EXPORT QItemModelSurfaceDataProxy : public QSurfaceDataProxy
     Q_PROPERTY(
         QItemModelSurfaceDataProxy::MultiMatchBehavior multiMatchBehavior READ multiMatchBehavior
             WRITE setMultiMatchBehavior NOTIFY multiMatchBehaviorChanged FINAL)
+    Q_PROPERTY(bool resolveInBackground READ resolveInBackground WRITE setResolveInBackground
+                   NOTIFY resolveInBackgroundChanged REVISION(6, 10) FINAL)
     QML_NAMED_ELEMENT(ItemModelSurfaceDataProxy)
 
 public:
@@ -166,6 +168,9 @@ public:
     void setMultiMatchBehavior(QItemModelSurfaceDataProxy::MultiMatchBehavior behavior);
     QItemModelSurfaceDataProxy::MultiMatchBehavior multiMatchBehavior() const;
 
+    void setResolveInBackground(bool enable);
+    bool resolveInBackground() const;
+
 Q_SIGNALS:
     void itemModelChanged(const QAbstractItemModel *itemModel);
     void rowRoleChanged(const QString &role);
@@ -189,6 +194,7 @@ Q_SIGNALS:
     void yPosRoleReplaceChanged(const QString &replace);
     void zPosRoleReplaceChanged(const QString &replace);
     void multiMatchBehaviorChanged(QItemModelSurfaceDataProxy::MultiMatchBehavior behavior);
+    Q_REVISION(6, 10) void resolveInBackgroundChanged(bool enable);
 
 private:
     Q_DISABLE_COPY(QItemModelSurfaceDataProxy)
@@ -63,6 +63,8 @@ private:
 
     QItemModelSurfaceDataProxy::MultiMatchBehavior m_multiMatchBehavior;
 
+    bool m_resolveInBackground;
+
     friend class SurfaceItemModelHandler;
 };
 
@@ -481,11 +481,13 @@ void QScatter3DSeriesPrivate::setItemSize(float size)
 void QScatter3DSeriesPrivate::setDataArray(const QScatterDataArray &newDataArray)
 {
     m_dataArray = newDataArray;
+    m_limitsDirty = true;
 }
 
 void QScatter3DSeriesPrivate::clearArray()
 {
     m_dataArray.clear();
+    m_limitsDirty = true;
 }
 
 QT_END_NAMESPACE
@@ -57,6 +57,7 @@ private:
     Q_DISABLE_COPY(QScatter3DSeries)
 
     friend class QQuickGraphsScatter;
+    friend class QScatterDataProxyPrivate;
 };
 
 QT_END_NAMESPACE
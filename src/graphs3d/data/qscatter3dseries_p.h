@@ -17,6 +17,8 @@
 #include "qabstract3dseries_p.h"
 #include "qscatter3dseries.h"
 
+#include <array>
+
 QT_BEGIN_NAMESPACE
 
 class QScatter3DSeriesPrivate : public QAbstract3DSeriesPrivate
@@ -42,7 +44,14 @@ private:
     float m_itemSize;
     QScatterDataArray m_dataArray;
 
+    // Extents of m_dataArray, kept up to date by QScatterDataProxyPrivate
+    QVector3D m_minValues;
+    QVector3D m_maxValues;
+    std::array<bool, 6> m_limitAxisFlags = {};
+    bool m_limitsDirty = true;
+
     friend class QQuickGraphsScatter;
+    friend class QScatterDataProxyPrivate;
 };
 
 QT_END_NAMESPACE
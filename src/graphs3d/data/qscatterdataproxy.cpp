@@ -148,8 +148,9 @@ void QScatterDataProxy::setItem(qsizetype index, QScatterDataItem item)
 void QScatterDataProxy::setItems(qsizetype index, QScatterDataArray items)
 {
     Q_D(QScatterDataProxy);
+    const qsizetype count = items.size();
     d->setItems(index, std::move(items));
-    emit itemsChanged(index, items.size());
+    emit itemsChanged(index, count);
 }
 
 /*!
@@ -305,29 +306,36 @@ void QScatterDataProxyPrivate::resetArray(QScatterDataArray &&newArray)
 void QScatterDataProxyPrivate::setItem(qsizetype index, QScatterDataItem &&item)
 {
     auto *scatterSeries = static_cast<QScatter3DSeries *>(series());
-    Q_ASSERT(index >= 0 && index < scatterSeries->dataArray().size());
-    QScatterDataArray array = scatterSeries->dataArray();
-    array[index] = item;
-    scatterSeries->setDataArray(array);
+    QScatter3DSeriesPrivate *seriesPrivate = scatterSeries->d_func();
+    QScatterDataArray &array = seriesPrivate->m_dataArray;
+    Q_ASSERT(index >= 0 && index < array.size());
+    excludeFromLimits(seriesPrivate, index, 1);
+    array[index] = std::move(item);
+    includeInLimits(seriesPrivate, index, 1);
+    emit scatterSeries->dataArrayChanged(array);
 }
 
 void QScatterDataProxyPrivate::setItems(qsizetype index, QScatterDataArray &&items)
 {
     auto *scatterSeries = static_cast<QScatter3DSeries *>(series());
-    Q_ASSERT(index >= 0 && (index + items.size()) <= scatterSeries->dataArray().size());
-    QScatterDataArray array = scatterSeries->dataArray();
-    for (int i = 0; i < items.size(); i++)
-        array[index++] = items[i];
-    scatterSeries->setDataArray(array);
+    QScatter3DSeriesPrivate *seriesPrivate = scatterSeries->d_func();
+    QScatterDataArray &array = seriesPrivate->m_dataArray;
+    Q_ASSERT(index >= 0 && (index + items.size()) <= array.size());
+    excludeFromLimits(seriesPrivate, index, items.size());
+    std::move(items.begin(), items.end(), array.begin() + index);
+    includeInLimits(seriesPrivate, index, items.size());
+    emit scatterSeries->dataArrayChanged(array);
 }
 
 qsizetype QScatterDataProxyPrivate::addItem(QScatterDataItem &&item)
 {
     auto *scatterSeries = static_cast<QScatter3DSeries *>(series());
-    qsizetype currentSize = scatterSeries->dataArray().size();
-    QScatterDataArray array = scatterSeries->dataArray();
-    array.append(item);
-    scatterSeries->setDataArray(array);
+    QScatter3DSeriesPrivate *seriesPrivate = scatterSeries->d_func();
+    QScatterDataArray &array = seriesPrivate->m_dataArray;
+    qsizetype currentSize = array.size();
+    array.append(std::move(item));
+    includeInLimits(seriesPrivate, currentSize, 1);
+    emit scatterSeries->dataArrayChanged(array);
     return currentSize;
 }
 
@@ -336,10 +344,12 @@ qsizetype QScatterDataProxyPrivate::addItems(QScatterDataArray &&items)
     auto *scatterSeries = static_cast<QScatter3DSeries *>(series());
     qsizetype currentSize = 0;
     if (scatterSeries) {
-        currentSize = scatterSeries->dataArray().size();
-        QScatterDataArray array = scatterSeries->dataArray();
-        array += items;
-        scatterSeries->setDataArray(array);
+        QScatter3DSeriesPrivate *seriesPrivate = scatterSeries->d_func();
+        QScatterDataArray &array = seriesPrivate->m_dataArray;
+        currentSize = array.size();
+        array.append(std::move(items));
+        includeInLimits(seriesPrivate, currentSize, array.size() - currentSize);
+        emit scatterSeries->dataArrayChanged(array);
     }
     return currentSize;
 }
@@ -347,31 +357,38 @@ qsizetype QScatterDataProxyPrivate::addItems(QScatterDataArray &&items)
 void QScatterDataProxyPrivate::insertItem(qsizetype index, QScatterDataItem &&item)
 {
     auto *scatterSeries = static_cast<QScatter3DSeries *>(series());
-    Q_ASSERT(index >= 0 && index <= scatterSeries->dataArray().size());
-    QScatterDataArray array = scatterSeries->dataArray();
-    array.insert(index, item);
-    scatterSeries->setDataArray(array);
+    QScatter3DSeriesPrivate *seriesPrivate = scatterSeries->d_func();
+    QScatterDataArray &array = seriesPrivate->m_dataArray;
+    Q_ASSERT(index >= 0 && index <= array.size());
+    array.insert(index, std::move(item));
+    includeInLimits(seriesPrivate, index, 1);
+    emit scatterSeries->dataArrayChanged(array);
 }
 
 void QScatterDataProxyPrivate::insertItems(qsizetype index, QScatterDataArray &&items)
 {
     auto *scatterSeries = static_cast<QScatter3DSeries *>(series());
-    Q_ASSERT(index >= 0 && index <= scatterSeries->dataArray().size());
-    QScatterDataArray array = scatterSeries->dataArray();
-    for (int i = 0; i < items.size(); i++)
-        array.insert(index++, items.at(i));
-    scatterSeries->setDataArray(array);
+    QScatter3DSeriesPrivate *seriesPrivate = scatterSeries->d_func();
+    QScatterDataArray &array = seriesPrivate->m_dataArray;
+    Q_ASSERT(index >= 0 && index <= array.size());
+    // Open the gap once instead of shifting the tail for every inserted item
+    array.insert(index, items.size(), QScatterDataItem());
+    std::move(items.begin(), items.end(), array.begin() + index);
+    includeInLimits(seriesPrivate, index, items.size());
+    emit scatterSeries->dataArrayChanged(array);
 }
 
 void QScatterDataProxyPrivate::removeItems(qsizetype index, qsizetype removeCount)
 {
     auto *scatterSeries = static_cast<QScatter3DSeries *>(series());
+    QScatter3DSeriesPrivate *seriesPrivate = scatterSeries->d_func();
+    QScatterDataArray &array = seriesPrivate->m_dataArray;
     Q_ASSERT(index >= 0);
-    qsizetype maxRemoveCount = scatterSeries->dataArray().size() - index;
+    qsizetype maxRemoveCount = array.size() - index;
     removeCount = qMin(removeCount, maxRemoveCount);
-    QScatterDataArray array = scatterSeries->dataArray();
+    excludeFromLimits(seriesPrivate, index, removeCount);
     array.remove(index, removeCount);
-    scatterSeries->setDataArray(array);
+    emit scatterSeries->dataArrayChanged(array);
 }
 
 void QScatterDataProxyPrivate::limitValues(QVector3D &minValues,
@@ -380,65 +397,99 @@ void QScatterDataProxyPrivate::limitValues(QVector3D &minValues,
                                            QAbstract3DAxis *axisY,
                                            QAbstract3DAxis *axisZ) const
 {
-    auto *scatterSeries = static_cast<QScatter3DSeries *>(series());
-    if (scatterSeries->dataArray().isEmpty())
+    QScatter3DSeriesPrivate *seriesPrivate = static_cast<QScatter3DSeries *>(series())->d_func();
+    const QScatterDataArray &array = seriesPrivate->m_dataArray;
+    if (array.isEmpty())
         return;
 
-    QVector3D firstPos = scatterSeries->dataArray().at(0).position();
+    const std::array<bool, 6> axisFlags = {axisX->d_func()->allowZero(),
+                                           axisX->d_func()->allowNegatives(),
+                                           axisY->d_func()->allowZero(),
+                                           axisY->d_func()->allowNegatives(),
+                                           axisZ->d_func()->allowZero(),
+                                           axisZ->d_func()->allowNegatives()};
+
+    // The extents are maintained incrementally by the item setters, so a full
+    // scan is only needed when an edit touched a limit or the axis type changed.
+    if (seriesPrivate->m_limitsDirty || seriesPrivate->m_limitAxisFlags != axisFlags) {
+        seriesPrivate->m_limitAxisFlags = axisFlags;
+        seriesPrivate->m_minValues = array.at(0).position();
+        seriesPrivate->m_maxValues = seriesPrivate->m_minValues;
+        seriesPrivate->m_limitsDirty = false;
+        includeInLimits(seriesPrivate, 1, array.size() - 1);
+    }
 
-    float minX = firstPos.x();
-    float maxX = minX;
-    float minY = firstPos.y();
-    float maxY = minY;
-    float minZ = firstPos.z();
-    float maxZ = minZ;
+    minValues = seriesPrivate->m_minValues;
+    maxValues = seriesPrivate->m_maxValues;
+}
 
-    if (scatterSeries->dataArray().size() > 1) {
-        for (int i = 1; i < scatterSeries->dataArray().size(); i++) {
-            QVector3D pos = scatterSeries->dataArray().at(i).position();
+bool QScatterDataProxyPrivate::isValidValue(float axisValue,
+                                            float value,
+                                            bool allowZero,
+                                            bool allowNegatives)
+{
+    return (axisValue > value
+            && (value > 0.0f || (value == 0.0f && allowZero)
+                || (value < 0.0f && allowNegatives)));
+}
 
-            float value = pos.x();
-            if (qIsNaN(value) || qIsInf(value))
-                continue;
-            if (isValidValue(minX, value, axisX))
-                minX = value;
-            if (maxX < value)
-                maxX = value;
+void QScatterDataProxyPrivate::includeInLimits(QScatter3DSeriesPrivate *seriesPrivate,
+                                               qsizetype index,
+                                               qsizetype count) const
+{
+    if (seriesPrivate->m_limitsDirty || count <= 0)
+        return;
 
-            value = pos.y();
-            if (qIsNaN(value) || qIsInf(value))
-                continue;
-            if (isValidValue(minY, value, axisY))
-                minY = value;
-            if (maxY < value)
-                maxY = value;
+    // The first item seeds the extents unconditionally, so replacing it or
+    // shifting it to a later index needs a rescan.
+    if (index == 0) {
+        seriesPrivate->m_limitsDirty = true;
+        return;
+    }
 
-            value = pos.z();
+    const QScatterDataArray &array = seriesPrivate->m_dataArray;
+    const std::array<bool, 6> &axisFlags = seriesPrivate->m_limitAxisFlags;
+    QVector3D &minValues = seriesPrivate->m_minValues;
+    QVector3D &maxValues = seriesPrivate->m_maxValues;
+    for (qsizetype i = index; i < index + count; ++i) {
+        const QVector3D pos = array.at(i).position();
+        for (int axis = 0; axis < 3; ++axis) {
+            const float value = pos[axis];
+            // An invalid component also excludes the rest of the item
             if (qIsNaN(value) || qIsInf(value))
-                continue;
-            if (isValidValue(minZ, value, axisZ))
-                minZ = value;
-            if (maxZ < value)
-                maxZ = value;
+                break;
+            if (isValidValue(minValues[axis], value, axisFlags[2 * axis], axisFlags[2 * axis + 1]))
+                minValues[axis] = value;
+            if (maxValues[axis] < value)
+                maxValues[axis] = value;
         }
     }
-
-    minValues.setX(minX);
-    minValues.setY(minY);
-    minValues.setZ(minZ);
-
-    maxValues.setX(maxX);
-    maxValues.setY(maxY);
-    maxValues.setZ(maxZ);
 }
 
-bool QScatterDataProxyPrivate::isValidValue(float axisValue,
-                                            float value,
-                                            QAbstract3DAxis *axis) const
+void QScatterDataProxyPrivate::excludeFromLimits(QScatter3DSeriesPrivate *seriesPrivate,
+                                                 qsizetype index,
+                                                 qsizetype count) const
 {
-    return (axisValue > value
-            && (value > 0.0f || (value == 0.0f && axis->d_func()->allowZero())
-                || (value < 0.0f && axis->d_func()->allowNegatives())));
+    if (seriesPrivate->m_limitsDirty || count <= 0)
+        return;
+
+    if (index == 0) {
+        seriesPrivate->m_limitsDirty = true;
+        return;
+    }
+
+    const QScatterDataArray &array = seriesPrivate->m_dataArray;
+    const QVector3D &minValues = seriesPrivate->m_minValues;
+    const QVector3D &maxValues = seriesPrivate->m_maxValues;
+    for (qsizetype i = index; i < index + count; ++i) {
+        const QVector3D pos = array.at(i).position();
+        for (int axis = 0; axis < 3; ++axis) {
+            if (pos[axis] == minValues[axis] || pos[axis] == maxValues[axis]) {
+                seriesPrivate->m_limitsDirty = true;
+                return;
+            }
+        }
+    }
 }
 
 void QScatterDataProxyPrivate::setSeries(QAbstract3DSeries *series)
@@ -21,6 +21,7 @@
 QT_BEGIN_NAMESPACE
 
 class QAbstract3DAxis;
+class QScatter3DSeriesPrivate;
 
 class QScatterDataProxyPrivate : public QAbstractDataProxyPrivate
 {
@@ -43,9 +44,17 @@ public:
                      QAbstract3DAxis *axisX,
                      QAbstract3DAxis *axisY,
                      QAbstract3DAxis *axisZ) const;
-    bool isValidValue(float axisValue, float value, QAbstract3DAxis *axis) const;
+    static bool isValidValue(float axisValue, float value, bool allowZero, bool allowNegatives);
 
     void setSeries(QAbstract3DSeries *series) override;
+
+private:
+    void includeInLimits(QScatter3DSeriesPrivate *seriesPrivate,
+                         qsizetype index,
+                         qsizetype count) const;
+    void excludeFromLimits(QScatter3DSeriesPrivate *seriesPrivate,
+                           qsizetype index,
+                           qsizetype count) const;
 };
 
 QT_END_NAMESPACE
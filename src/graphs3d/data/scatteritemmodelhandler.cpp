@@ -4,23 +4,30 @@
 #include "qscatter3dseries_p.h"
 #include "scatteritemmodelhandler_p.h"
 
+#include <QtCore/QPromise>
+#include <QtCore/QThreadPool>
+
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 ScatterItemModelHandler::ScatterItemModelHandler(QItemModelScatterDataProxy *proxy, QObject *parent)
     : AbstractItemModelHandler(parent)
     , m_proxy(proxy)
     , m_proxyArray(0)
-    , m_xPosRole(noRoleIndex)
-    , m_yPosRole(noRoleIndex)
-    , m_zPosRole(noRoleIndex)
-    , m_rotationRole(noRoleIndex)
-    , m_haveXPosPattern(false)
-    , m_haveYPosPattern(false)
-    , m_haveZPosPattern(false)
-    , m_haveRotationPattern(false)
-{}
-
-ScatterItemModelHandler::~ScatterItemModelHandler() {}
+    , m_resolving(false)
+    , m_resolveAgain(false)
+{
+    QObject::connect(&m_resolveWatcher,
+                     &QFutureWatcher<ResolveJob>::finished,
+                     this,
+                     &ScatterItemModelHandler::handleResolveFinished);
+}
+
+ScatterItemModelHandler::~ScatterItemModelHandler()
+{
+    m_resolveWatcher.cancel();
+}
 
 void ScatterItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
                                                 const QModelIndex &bottomRight,
@@ -28,10 +35,31 @@ void ScatterItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
 {
     // Do nothing if full reset already pending
     if (!m_fullReset) {
-        if (m_itemModel->columnCount() > 1) {
-            // If the data model is multi-column, do full asynchronous reset to
-            // simplify things
+        const int columnCount = m_itemModel->columnCount();
+        if (m_resolving) {
+            // A resolve in progress would overwrite the change with the data copied
+            // before it
             AbstractItemModelHandler::handleDataChanged(topLeft, bottomRight, roles);
+        } else if (columnCount > 1) {
+            if (m_proxy->itemCount() != qsizetype(m_itemModel->rowCount()) * columnCount) {
+                // The items no longer match the model layout, so do full asynchronous reset
+                AbstractItemModelHandler::handleDataChanged(topLeft, bottomRight, roles);
+                return;
+            }
+            // Items are laid out row by row, so each changed model row is a contiguous span
+            int startRow = qMin(topLeft.row(), bottomRight.row());
+            int endRow = qMax(topLeft.row(), bottomRight.row());
+            int startColumn = qMin(topLeft.column(), bottomRight.column());
+            int endColumn = qMax(topLeft.column(), bottomRight.column());
+
+            for (int i = startRow; i <= endRow; i++) {
+                QScatterDataArray array(endColumn - startColumn + 1);
+                int count = 0;
+                for (int j = startColumn; j <= endColumn; j++)
+                    modelPosToScatterItem(i, j, array[count++]);
+
+                m_proxy->setItems(qsizetype(i) * columnCount + startColumn, array);
+            }
         } else {
             int start = qMin(topLeft.row(), bottomRight.row());
             int end = qMax(topLeft.row(), bottomRight.row());
@@ -50,10 +78,11 @@ void ScatterItemModelHandler::handleRowsInserted(const QModelIndex &parent, int
 {
     // Do nothing if full reset already pending
     if (!m_fullReset) {
-        if (!m_proxy->itemCount() || m_itemModel->columnCount() > 1) {
+        if (!m_proxy->itemCount() || m_itemModel->columnCount() > 1 || m_resolving) {
             // If inserting into an empty array, do full asynchronous reset to avoid
             // multiple separate inserts when initializing the model. If the data
-            // model is multi-column, do full asynchronous reset to simplify things
+            // model is multi-column or being resolved, do full asynchronous reset to
+            // simplify things
             AbstractItemModelHandler::handleRowsInserted(parent, start, end);
         } else {
             QScatterDataArray array(end - start + 1);
@@ -72,9 +101,9 @@ void ScatterItemModelHandler::handleRowsRemoved(const QModelIndex &parent, int s
 
     // Do nothing if full reset already pending
     if (!m_fullReset) {
-        if (m_itemModel->columnCount() > 1) {
-            // If the data model is multi-column, do full asynchronous reset to
-            // simplify things
+        if (m_itemModel->columnCount() > 1 || m_resolving) {
+            // If the data model is multi-column or being resolved, do full
+            // asynchronous reset to simplify things
             AbstractItemModelHandler::handleRowsRemoved(parent, start, end);
         } else {
             m_proxy->removeItems(start, end - start + 1);
@@ -117,57 +146,88 @@ static inline QQuaternion toQuaternion(const QVariant &variant)
     return QQuaternion();
 }
 
+void ScatterItemModelHandler::ItemMapping::toScatterItem(const QModelRoleDataSpan &data,
+                                                          QScatterDataItem &item) const
+{
+    float xPos = 0.0f;
+    float yPos = 0.0f;
+    float zPos = 0.0f;
+    if (xPosRole != -1)
+        xPos = xPosExtractor.toFloat(*data.dataForRole(xPosRole));
+    if (yPosRole != -1)
+        yPos = yPosExtractor.toFloat(*data.dataForRole(yPosRole));
+    if (zPosRole != -1)
+        zPos = zPosExtractor.toFloat(*data.dataForRole(zPosRole));
+    if (rotationRole != -1) {
+        const QVariant &rotationVar = *data.dataForRole(rotationRole);
+        if (rotationExtractor.hasPattern())
+            item.setRotation(toQuaternion(QVariant(rotationExtractor.toString(rotationVar))));
+        else
+            item.setRotation(toQuaternion(rotationVar));
+    }
+
+    item.setPosition(QVector3D(xPos, yPos, zPos));
+}
+
 void ScatterItemModelHandler::modelPosToScatterItem(int modelRow,
                                                     int modelColumn,
                                                     QScatterDataItem &item)
 {
-    QModelIndex index = m_itemModel->index(modelRow, modelColumn);
-    float xPos;
-    float yPos;
-    float zPos;
-    if (m_xPosRole != noRoleIndex) {
-        QVariant xValueVar = index.data(m_xPosRole);
-        if (m_haveXPosPattern)
-            xPos = xValueVar.toString().replace(m_xPosPattern, m_xPosReplace).toFloat();
-        else
-            xPos = xValueVar.toFloat();
-    } else {
-        xPos = 0.0f;
-    }
-    if (m_yPosRole != noRoleIndex) {
-        QVariant yValueVar = index.data(m_yPosRole);
-        if (m_haveYPosPattern)
-            yPos = yValueVar.toString().replace(m_yPosPattern, m_yPosReplace).toFloat();
-        else
-            yPos = yValueVar.toFloat();
-    } else {
-        yPos = 0.0f;
-    }
-    if (m_zPosRole != noRoleIndex) {
-        QVariant zValueVar = index.data(m_zPosRole);
-        if (m_haveZPosPattern)
-            zPos = zValueVar.toString().replace(m_zPosPattern, m_zPosReplace).toFloat();
-        else
-            zPos = zValueVar.toFloat();
-    } else {
-        zPos = 0.0f;
+    m_mapping.toScatterItem(fetchRoles(m_itemModel->index(modelRow, modelColumn)), item);
+}
+
+template<typename Fetch, typename Canceled>
+bool ScatterItemModelHandler::buildArray(ResolveJob &job, Fetch fetch, Canceled canceled)
+{
+    QScatterDataArray &array = job.array;
+    array.resize(qsizetype(job.rowCount) * job.columnCount);
+
+    // Parse data into the array
+    qsizetype runningCount = 0;
+    for (int i = 0; i < job.rowCount; i++) {
+        if (canceled())
+            return false;
+        for (int j = 0; j < job.columnCount; j++)
+            job.mapping.toScatterItem(fetch(i, j), array[runningCount++]);
     }
-    if (m_rotationRole != noRoleIndex) {
-        QVariant rotationVar = index.data(m_rotationRole);
-        if (m_haveRotationPattern) {
-            item.setRotation(toQuaternion(
-                QVariant(rotationVar.toString().replace(m_rotationPattern, m_rotationReplace))));
-        } else {
-            item.setRotation(toQuaternion(rotationVar));
-        }
+    return true;
+}
+
+void ScatterItemModelHandler::applyResolveJob(ResolveJob &job)
+{
+    m_proxyArray = std::move(job.array);
+    m_proxy->resetArray(m_proxyArray);
+}
+
+void ScatterItemModelHandler::handleResolveFinished()
+{
+    QFuture<ResolveJob> future = m_resolveWatcher.future();
+    if (!m_resolving || future.isCanceled())
+        return;
+
+    m_resolving = false;
+    if (future.resultCount()) {
+        ResolveJob job = future.takeResult();
+        applyResolveJob(job);
     }
 
-    item.setPosition(QVector3D(xPos, yPos, zPos));
+    // Pick up the changes that were made while resolving
+    if (m_resolveAgain) {
+        m_resolveAgain = false;
+        resolveModel();
+    }
 }
 
 // Resolve entire item model into QScatterDataArray.
 void ScatterItemModelHandler::resolveModel()
 {
+    // Restarting a resolve in progress on every change could keep it from ever
+    // finishing, so let it complete and resolve once more when it has
+    if (m_resolving) {
+        m_resolveAgain = true;
+        return;
+    }
+
     if (m_itemModel.isNull()) {
         QScatterDataArray empty;
         m_proxy->resetArray(empty);
@@ -175,45 +235,64 @@ void ScatterItemModelHandler::resolveModel()
         return;
     }
 
-    m_xPosPattern = m_proxy->xPosRolePattern();
-    m_yPosPattern = m_proxy->yPosRolePattern();
-    m_zPosPattern = m_proxy->zPosRolePattern();
-    m_rotationPattern = m_proxy->rotationRolePattern();
-    m_xPosReplace = m_proxy->xPosRoleReplace();
-    m_yPosReplace = m_proxy->yPosRoleReplace();
-    m_zPosReplace = m_proxy->zPosRoleReplace();
-    m_rotationReplace = m_proxy->rotationRoleReplace();
-    m_haveXPosPattern = !m_xPosPattern.namedCaptureGroups().isEmpty() && m_xPosPattern.isValid();
-    m_haveYPosPattern = !m_yPosPattern.namedCaptureGroups().isEmpty() && m_yPosPattern.isValid();
-    m_haveZPosPattern = !m_zPosPattern.namedCaptureGroups().isEmpty() && m_zPosPattern.isValid();
-    m_haveRotationPattern = !m_rotationPattern.namedCaptureGroups().isEmpty()
-                            && m_rotationPattern.isValid();
+    // The mapping is reused on single item changes, so store it to a member variable.
+    m_mapping.xPosExtractor.setPattern(m_proxy->xPosRolePattern(), m_proxy->xPosRoleReplace());
+    m_mapping.yPosExtractor.setPattern(m_proxy->yPosRolePattern(), m_proxy->yPosRoleReplace());
+    m_mapping.zPosExtractor.setPattern(m_proxy->zPosRolePattern(), m_proxy->zPosRoleReplace());
+    m_mapping.rotationExtractor.setPattern(m_proxy->rotationRolePattern(),
+                                           m_proxy->rotationRoleReplace());
 
     QHash<int, QByteArray> roleHash = m_itemModel->roleNames();
-    m_xPosRole = roleHash.key(m_proxy->xPosRole().toLatin1(), noRoleIndex);
-    m_yPosRole = roleHash.key(m_proxy->yPosRole().toLatin1(), noRoleIndex);
-    m_zPosRole = roleHash.key(m_proxy->zPosRole().toLatin1(), noRoleIndex);
-    m_rotationRole = roleHash.key(m_proxy->rotationRole().toLatin1(), noRoleIndex);
-    const int columnCount = m_itemModel->columnCount();
-    const int rowCount = m_itemModel->rowCount();
-    const int totalCount = rowCount * columnCount;
-    int runningCount = 0;
-
-    // If dimensions have changed, recreate the array
-    if (m_proxyArray.data() != m_proxy->series()->dataArray().data()
-        || totalCount != m_proxyArray.size()) {
-        m_proxyArray.resize(totalCount);
-    }
+    m_mapping.xPosRole = roleHash.key(m_proxy->xPosRole().toLatin1(), noRoleIndex);
+    m_mapping.yPosRole = roleHash.key(m_proxy->yPosRole().toLatin1(), noRoleIndex);
+    m_mapping.zPosRole = roleHash.key(m_proxy->zPosRole().toLatin1(), noRoleIndex);
+    m_mapping.rotationRole = roleHash.key(m_proxy->rotationRole().toLatin1(), noRoleIndex);
+    setFetchRoles({m_mapping.xPosRole,
+                   m_mapping.yPosRole,
+                   m_mapping.zPosRole,
+                   m_mapping.rotationRole});
+
+    ResolveJob job;
+    job.mapping = m_mapping;
+    job.rowCount = m_itemModel->rowCount();
+    job.columnCount = m_itemModel->columnCount();
 
-    // Parse data into newProxyArray
-    for (int i = 0; i < rowCount; i++) {
-        for (int j = 0; j < columnCount; j++) {
-            modelPosToScatterItem(i, j, m_proxyArray[runningCount]);
-            runningCount++;
+    if (m_proxy->resolveInBackground()) {
+        // The model can only be accessed on this thread, so copy its data for the worker
+        const qsizetype roleCount = m_fetchRoleData.size();
+        QList<QModelRoleData> snapshot;
+        snapshot.reserve(qsizetype(job.rowCount) * job.columnCount * roleCount);
+        for (int i = 0; i < job.rowCount; i++) {
+            for (int j = 0; j < job.columnCount; j++) {
+                for (const QModelRoleData &data : fetchRoles(m_itemModel->index(i, j)))
+                    snapshot.append(data);
+            }
         }
-    }
 
-    m_proxy->resetArray(m_proxyArray);
+        auto promise = std::make_shared<QPromise<ResolveJob>>();
+        m_resolveWatcher.setFuture(promise->future());
+        m_resolving = true;
+        QThreadPool::globalInstance()->start(
+            [promise, job = std::move(job), snapshot = std::move(snapshot), roleCount]() mutable {
+                promise->start();
+                auto fetch = [&](int row, int column) {
+                    const qsizetype index = qsizetype(row) * job.columnCount + column;
+                    return QModelRoleDataSpan(snapshot.data() + index * roleCount, roleCount);
+                };
+                if (buildArray(job, fetch, [&]() { return promise->isCanceled(); }))
+                    promise->addResult(std::move(job));
+                promise->finish();
+            });
+    } else {
+        // Reuse the array if the series still has it
+        if (m_proxyArray.data() == m_proxy->series()->dataArray().data())
+            job.array = std::move(m_proxyArray);
+        buildArray(
+            job,
+            [this](int row, int column) { return fetchRoles(m_itemModel->index(row, column)); },
+            []() { return false; });
+        applyResolveJob(job);
+    }
 }
 
 QT_END_NAMESPACE
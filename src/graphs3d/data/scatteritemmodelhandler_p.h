@@ -16,6 +16,7 @@
 
 #include "abstractitemmodelhandler_p.h"
 #include "qitemmodelscatterdataproxy_p.h"
+#include <QtCore/QFutureWatcher>
 
 QT_BEGIN_NAMESPACE
 
@@ -36,27 +37,46 @@ public Q_SLOTS:
 protected:
     void resolveModel() override;
 
+private Q_SLOTS:
+    void handleResolveFinished();
+
 private:
+    // Maps the role data of a model item to a scatter item
+    struct ItemMapping
+    {
+        RoleExtractor xPosExtractor;
+        RoleExtractor yPosExtractor;
+        RoleExtractor zPosExtractor;
+        RoleExtractor rotationExtractor;
+        int xPosRole = -1;
+        int yPosRole = -1;
+        int zPosRole = -1;
+        int rotationRole = -1;
+
+        void toScatterItem(const QModelRoleDataSpan &data, QScatterDataItem &item) const;
+    };
+
+    // Everything needed to build the data array from the model data. It is filled on the
+    // GUI thread, so that the array can also be built on a worker thread.
+    struct ResolveJob
+    {
+        ItemMapping mapping;
+        int rowCount = 0;
+        int columnCount = 0;
+        QScatterDataArray array;
+    };
+
+    template<typename Fetch, typename Canceled>
+    static bool buildArray(ResolveJob &job, Fetch fetch, Canceled canceled);
+    void applyResolveJob(ResolveJob &job);
     void modelPosToScatterItem(int modelRow, int modelColumn, QScatterDataItem &item);
 
     QItemModelScatterDataProxy *m_proxy; // Not owned
     QScatterDataArray m_proxyArray;
-    int m_xPosRole;
-    int m_yPosRole;
-    int m_zPosRole;
-    int m_rotationRole;
-    QRegularExpression m_xPosPattern;
-    QRegularExpression m_yPosPattern;
-    QRegularExpression m_zPosPattern;
-    QRegularExpression m_rotationPattern;
-    QString m_xPosReplace;
-    QString m_yPosReplace;
-    QString m_zPosReplace;
-    QString m_rotationReplace;
-    bool m_haveXPosPattern;
-    bool m_haveYPosPattern;
-    bool m_haveZPosPattern;
-    bool m_haveRotationPattern;
+    ItemMapping m_mapping;
+    QFutureWatcher<ResolveJob> m_resolveWatcher;
+    bool m_resolving;
+    bool m_resolveAgain;
 };
 
 QT_END_NAMESPACE
@@ -4,6 +4,11 @@
 #include "qsurface3dseries_p.h"
 #include "surfaceitemmodelhandler_p.h"
 
+#include <QtCore/QPromise>
+#include <QtCore/QThreadPool>
+
+#include <memory>
+
 QT_BEGIN_NAMESPACE
 
 SurfaceItemModelHandler::SurfaceItemModelHandler(QItemModelSurfaceDataProxy *proxy, QObject *parent)
@@ -13,12 +18,19 @@ SurfaceItemModelHandler::SurfaceItemModelHandler(QItemModelSurfaceDataProxy *pro
     , m_xPosRole(noRoleIndex)
     , m_yPosRole(noRoleIndex)
     , m_zPosRole(noRoleIndex)
-    , m_haveXPosPattern(false)
-    , m_haveYPosPattern(false)
-    , m_haveZPosPattern(false)
-{}
+    , m_resolving(false)
+    , m_resolveAgain(false)
+{
+    QObject::connect(&m_resolveWatcher,
+                     &QFutureWatcher<ResolveJob>::finished,
+                     this,
+                     &SurfaceItemModelHandler::handleResolveFinished);
+}
 
-SurfaceItemModelHandler::~SurfaceItemModelHandler() {}
+SurfaceItemModelHandler::~SurfaceItemModelHandler()
+{
+    m_resolveWatcher.cancel();
+}
 
 void SurfaceItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
                                                 const QModelIndex &bottomRight,
@@ -26,9 +38,10 @@ void SurfaceItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
 {
     // Do nothing if full reset already pending
     if (!m_fullReset) {
-        if (!m_proxy->useModelCategories()) {
+        if (!m_proxy->useModelCategories() || m_resolving) {
             // If the data model doesn't directly map rows and columns, we cannot
-            // optimize
+            // optimize. A resolve in progress would also overwrite the change with
+            // the data copied before it.
             AbstractItemModelHandler::handleDataChanged(topLeft, bottomRight, roles);
         } else {
             int startRow = qMin(topLeft.row(), bottomRight.row());
@@ -38,43 +51,23 @@ void SurfaceItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
 
             for (int i = startRow; i <= endRow; i++) {
                 for (int j = startCol; j <= endCol; j++) {
-                    QModelIndex index = m_itemModel->index(i, j);
+                    QModelRoleDataSpan data = fetchRoles(m_itemModel->index(i, j));
                     QSurfaceDataItem item;
-                    QVariant xValueVar = index.data(m_xPosRole);
-                    QVariant yValueVar = index.data(m_yPosRole);
-                    QVariant zValueVar = index.data(m_zPosRole);
                     const QSurfaceDataItem &oldItem = m_proxy->itemAt(i, j);
                     float xPos;
                     float yPos;
                     float zPos;
-                    if (m_xPosRole != noRoleIndex) {
-                        if (m_haveXPosPattern) {
-                            xPos = xValueVar.toString()
-                                       .replace(m_xPosPattern, m_xPosReplace)
-                                       .toFloat();
-                        } else {
-                            xPos = xValueVar.toFloat();
-                        }
-                    } else {
+                    if (m_xPosRole != noRoleIndex)
+                        xPos = m_xPosExtractor.toFloat(*data.dataForRole(m_xPosRole));
+                    else
                         xPos = oldItem.x();
-                    }
 
-                    if (m_haveYPosPattern)
-                        yPos = yValueVar.toString().replace(m_yPosPattern, m_yPosReplace).toFloat();
+                    yPos = m_yPosExtractor.toFloat(*data.dataForRole(m_yPosRole));
+
+                    if (m_zPosRole != noRoleIndex)
+                        zPos = m_zPosExtractor.toFloat(*data.dataForRole(m_zPosRole));
                     else
-                        yPos = yValueVar.toFloat();
-
-                    if (m_zPosRole != noRoleIndex) {
-                        if (m_haveZPosPattern) {
-                            zPos = zValueVar.toString()
-                                       .replace(m_zPosPattern, m_zPosReplace)
-                                       .toFloat();
-                        } else {
-                            zPos = zValueVar.toFloat();
-                        }
-                    } else {
                         zPos = oldItem.z();
-                    }
                     item.setPosition(QVector3D(xPos, yPos, zPos));
                     m_proxy->setItem(i, j, item);
                 }
@@ -83,9 +76,188 @@ void SurfaceItemModelHandler::handleDataChanged(const QModelIndex &topLeft,
     }
 }
 
+template<typename Fetch, typename Canceled>
+bool SurfaceItemModelHandler::buildArray(ResolveJob &job, Fetch fetch, Canceled canceled)
+{
+    const int rowCount = job.rowCount;
+    const int columnCount = job.columnCount;
+    QSurfaceDataArray &array = job.array;
+
+    if (job.useModelCategories) {
+        // If dimensions have changed, recreate the array
+        if (array.size() != rowCount || (rowCount && array.at(0).size() != columnCount)) {
+            array.clear();
+            array.reserve(rowCount);
+            for (int i = 0; i < rowCount; i++)
+                array.append(QSurfaceDataRow(columnCount));
+        }
+        for (int i = 0; i < rowCount; i++) {
+            if (canceled())
+                return false;
+            QSurfaceDataRow &newProxyRow = array[i];
+            for (int j = 0; j < columnCount; j++) {
+                QModelRoleDataSpan data = fetch(i, j);
+                float xPos;
+                float yPos;
+                float zPos;
+                if (job.columnPositions.isEmpty())
+                    xPos = job.xPosExtractor.toFloat(*data.dataForRole(job.xPosRole));
+                else
+                    xPos = job.columnPositions.at(j);
+
+                yPos = job.yPosExtractor.toFloat(*data.dataForRole(job.yPosRole));
+
+                if (job.rowPositions.isEmpty())
+                    zPos = job.zPosExtractor.toFloat(*data.dataForRole(job.zPosRole));
+                else
+                    zPos = job.rowPositions.at(i);
+
+                newProxyRow[j].setPosition(QVector3D(xPos, yPos, zPos));
+            }
+        }
+        return true;
+    }
+
+    QStringList rowList;
+    QStringList columnList;
+    // For detecting duplicates in categories generation, using QHashes should
+    // be faster than simple QStringList::contains() check.
+    QHash<QString, bool> rowListHash;
+    QHash<QString, bool> columnListHash;
+
+    bool cumulative = job.multiMatchBehavior
+                          == QItemModelSurfaceDataProxy::MultiMatchBehavior::Average
+                      || job.multiMatchBehavior
+                             == QItemModelSurfaceDataProxy::MultiMatchBehavior::CumulativeY;
+    bool average = job.multiMatchBehavior == QItemModelSurfaceDataProxy::MultiMatchBehavior::Average;
+    bool takeFirst = job.multiMatchBehavior
+                     == QItemModelSurfaceDataProxy::MultiMatchBehavior::First;
+    QHash<QString, QHash<QString, int>> matchCountMap;
+
+    // Sort values into rows and columns
+    typedef QHash<QString, QVector3D> ColumnValueMap;
+    QHash<QString, ColumnValueMap> itemValueMap;
+    for (int i = 0; i < rowCount; i++) {
+        if (canceled())
+            return false;
+        for (int j = 0; j < columnCount; j++) {
+            QModelRoleDataSpan data = fetch(i, j);
+            QString rowRoleStr = job.rowExtractor.toString(*data.dataForRole(job.rowRole));
+            QString columnRoleStr = job.columnExtractor.toString(
+                *data.dataForRole(job.columnRole));
+            float xPos = job.xPosExtractor.toFloat(*data.dataForRole(job.xPosRole));
+            float yPos = job.yPosExtractor.toFloat(*data.dataForRole(job.yPosRole));
+            float zPos = job.zPosExtractor.toFloat(*data.dataForRole(job.zPosRole));
+
+            QVector3D itemPos(xPos, yPos, zPos);
+
+            if (cumulative)
+                matchCountMap[rowRoleStr][columnRoleStr]++;
+
+            if (cumulative) {
+                itemValueMap[rowRoleStr][columnRoleStr] += itemPos;
+            } else {
+                if (takeFirst && itemValueMap.contains(rowRoleStr)) {
+                    if (itemValueMap.value(rowRoleStr).contains(columnRoleStr))
+                        continue; // We already have a value for this row/column combo
+                }
+                itemValueMap[rowRoleStr][columnRoleStr] = itemPos;
+            }
+
+            if (job.generateRows && !rowListHash.value(rowRoleStr, false)) {
+                rowListHash.insert(rowRoleStr, true);
+                rowList << rowRoleStr;
+            }
+            if (job.generateColumns && !columnListHash.value(columnRoleStr, false)) {
+                columnListHash.insert(columnRoleStr, true);
+                columnList << columnRoleStr;
+            }
+        }
+    }
+
+    if (job.generateRows)
+        job.rowCategories = rowList;
+    else
+        rowList = job.rowCategories;
+
+    if (job.generateColumns)
+        job.columnCategories = columnList;
+    else
+        columnList = job.columnCategories;
+
+    // If dimensions have changed, recreate the array
+    if (array.size() != rowList.size()
+        || (!rowList.isEmpty() && array.at(0).size() != columnList.size())) {
+        array.clear();
+        array.reserve(rowList.size());
+        for (int i = 0; i < rowList.size(); i++)
+            array.append(QSurfaceDataRow(columnList.size()));
+    }
+    // Create data array from itemValueMap
+    for (int i = 0; i < rowList.size(); i++) {
+        QString rowKey = rowList.at(i);
+        QSurfaceDataRow &newProxyRow = array[i];
+        for (int j = 0; j < columnList.size(); j++) {
+            QVector3D &itemPos = itemValueMap[rowKey][columnList.at(j)];
+            if (cumulative) {
+                float divisor = float(matchCountMap[rowKey][columnList.at(j)]);
+                if (divisor) {
+                    if (average) {
+                        itemPos /= divisor;
+                    } else { // cumulativeY
+                        itemPos.setX(itemPos.x() / divisor);
+                        itemPos.setZ(itemPos.z() / divisor);
+                    }
+                }
+            }
+            newProxyRow[j].setPosition(itemPos);
+        }
+    }
+    return true;
+}
+
+void SurfaceItemModelHandler::applyResolveJob(ResolveJob &job)
+{
+    if (!job.useModelCategories) {
+        if (job.generateRows)
+            m_proxy->d_func()->m_rowCategories = job.rowCategories;
+        if (job.generateColumns)
+            m_proxy->d_func()->m_columnCategories = job.columnCategories;
+    }
+
+    m_proxyArray = std::move(job.array);
+    m_proxy->resetArray(m_proxyArray);
+}
+
+void SurfaceItemModelHandler::handleResolveFinished()
+{
+    QFuture<ResolveJob> future = m_resolveWatcher.future();
+    if (!m_resolving || future.isCanceled())
+        return;
+
+    m_resolving = false;
+    if (future.resultCount()) {
+        ResolveJob job = future.takeResult();
+        applyResolveJob(job);
+    }
+
+    // Pick up the changes that were made while resolving
+    if (m_resolveAgain) {
+        m_resolveAgain = false;
+        resolveModel();
+    }
+}
+
 // Resolve entire item model into QSurfaceDataArray.
 void SurfaceItemModelHandler::resolveModel()
 {
+    // Restarting a resolve in progress on every change could keep it from ever
+    // finishing, so let it complete and resolve once more when it has
+    if (m_resolving) {
+        m_resolveAgain = true;
+        return;
+    }
+
     if (m_itemModel.isNull()) {
         m_proxy->resetArray();
         m_proxyArray.clear();
@@ -101,21 +273,13 @@ void SurfaceItemModelHandler::resolveModel()
 
     // Position patterns can be reused on single item changes, so store them to
     // member variables.
-    QRegularExpression rowPattern(m_proxy->rowRolePattern());
-    QRegularExpression colPattern(m_proxy->columnRolePattern());
-    m_xPosPattern = m_proxy->xPosRolePattern();
-    m_yPosPattern = m_proxy->yPosRolePattern();
-    m_zPosPattern = m_proxy->zPosRolePattern();
-    QString rowReplace = m_proxy->rowRoleReplace();
-    QString colReplace = m_proxy->columnRoleReplace();
-    m_xPosReplace = m_proxy->xPosRoleReplace();
-    m_yPosReplace = m_proxy->yPosRoleReplace();
-    m_zPosReplace = m_proxy->zPosRoleReplace();
-    bool haveRowPattern = !rowPattern.namedCaptureGroups().isEmpty() && rowPattern.isValid();
-    bool haveColPattern = !colPattern.namedCaptureGroups().isEmpty() && colPattern.isValid();
-    m_haveXPosPattern = !m_xPosPattern.namedCaptureGroups().isEmpty() && m_xPosPattern.isValid();
-    m_haveYPosPattern = !m_yPosPattern.namedCaptureGroups().isEmpty() && m_yPosPattern.isValid();
-    m_haveZPosPattern = !m_zPosPattern.namedCaptureGroups().isEmpty() && m_zPosPattern.isValid();
+    m_xPosExtractor.setPattern(m_proxy->xPosRolePattern(), m_proxy->xPosRoleReplace());
+    m_yPosExtractor.setPattern(m_proxy->yPosRolePattern(), m_proxy->yPosRoleReplace());
+    m_zPosExtractor.setPattern(m_proxy->zPosRolePattern(), m_proxy->zPosRoleReplace());
+
+    ResolveJob job;
+    job.rowExtractor.setPattern(m_proxy->rowRolePattern(), m_proxy->rowRoleReplace());
+    job.columnExtractor.setPattern(m_proxy->columnRolePattern(), m_proxy->columnRoleReplace());
 
     QHash<int, QByteArray> roleHash = m_itemModel->roleNames();
 
@@ -123,197 +287,91 @@ void SurfaceItemModelHandler::resolveModel()
     m_xPosRole = roleHash.key(m_proxy->xPosRole().toLatin1(), noRoleIndex);
     m_yPosRole = roleHash.key(m_proxy->yPosRole().toLatin1(), Qt::DisplayRole);
     m_zPosRole = roleHash.key(m_proxy->zPosRole().toLatin1(), noRoleIndex);
-    int rowCount = m_itemModel->rowCount();
-    int columnCount = m_itemModel->columnCount();
+    job.rowCount = m_itemModel->rowCount();
+    job.columnCount = m_itemModel->columnCount();
+    job.useModelCategories = m_proxy->useModelCategories();
 
-    if (m_proxy->useModelCategories()) {
-        // If dimensions have changed, recreate the array
-        if (m_proxyArray.data() != m_proxy->series()->dataArray().data()
-            || columnCount != m_proxy->columnCount() || rowCount != m_proxyArray.size()) {
-            m_proxyArray.clear();
-            m_proxyArray.reserve(rowCount);
-            for (int i = 0; i < rowCount; i++)
-                m_proxyArray.append(QSurfaceDataRow(columnCount));
+    if (job.useModelCategories) {
+        setFetchRoles({m_xPosRole, m_yPosRole, m_zPosRole});
+        // Use headers for positions that are not mapped to roles
+        if (m_xPosRole == noRoleIndex) {
+            job.columnPositions.reserve(job.columnCount);
+            for (int j = 0; j < job.columnCount; j++) {
+                QString header = m_itemModel->headerData(j, Qt::Horizontal).toString();
+                bool ok = false;
+                float headerValue = header.toFloat(&ok);
+                job.columnPositions.append(ok ? headerValue : float(j));
+            }
         }
-        for (int i = 0; i < rowCount; i++) {
-            QSurfaceDataRow &newProxyRow = m_proxyArray[i];
-            for (int j = 0; j < columnCount; j++) {
-                QModelIndex index = m_itemModel->index(i, j);
-                QVariant xValueVar = index.data(m_xPosRole);
-                QVariant yValueVar = index.data(m_yPosRole);
-                QVariant zValueVar = index.data(m_zPosRole);
-                float xPos;
-                float yPos;
-                float zPos;
-                if (m_xPosRole != noRoleIndex) {
-                    if (m_haveXPosPattern)
-                        xPos = xValueVar.toString().replace(m_xPosPattern, m_xPosReplace).toFloat();
-                    else
-                        xPos = xValueVar.toFloat();
-                } else {
-                    QString header = m_itemModel->headerData(j, Qt::Horizontal).toString();
-                    bool ok = false;
-                    float headerValue = header.toFloat(&ok);
-                    if (ok)
-                        xPos = headerValue;
-                    else
-                        xPos = float(j);
-                }
-
-                if (m_haveYPosPattern)
-                    yPos = yValueVar.toString().replace(m_yPosPattern, m_yPosReplace).toFloat();
-                else
-                    yPos = yValueVar.toFloat();
-
-                if (m_zPosRole != noRoleIndex) {
-                    if (m_haveZPosPattern)
-                        zPos = zValueVar.toString().replace(m_zPosPattern, m_zPosReplace).toFloat();
-                    else
-                        zPos = zValueVar.toFloat();
-                } else {
-                    QString header = m_itemModel->headerData(i, Qt::Vertical).toString();
-                    bool ok = false;
-                    float headerValue = header.toFloat(&ok);
-                    if (ok)
-                        zPos = headerValue;
-                    else
-                        zPos = float(i);
-                }
-
-                newProxyRow[j].setPosition(QVector3D(xPos, yPos, zPos));
+        if (m_zPosRole == noRoleIndex) {
+            job.rowPositions.reserve(job.rowCount);
+            for (int i = 0; i < job.rowCount; i++) {
+                QString header = m_itemModel->headerData(i, Qt::Vertical).toString();
+                bool ok = false;
+                float headerValue = header.toFloat(&ok);
+                job.rowPositions.append(ok ? headerValue : float(i));
             }
         }
     } else {
-        int rowRole = roleHash.key(m_proxy->rowRole().toLatin1());
-        int columnRole = roleHash.key(m_proxy->columnRole().toLatin1());
+        job.rowRole = roleHash.key(m_proxy->rowRole().toLatin1());
+        job.columnRole = roleHash.key(m_proxy->columnRole().toLatin1());
         if (m_xPosRole == noRoleIndex)
-            m_xPosRole = columnRole;
+            m_xPosRole = job.columnRole;
         if (m_zPosRole == noRoleIndex)
-            m_zPosRole = rowRole;
-
-        bool generateRows = m_proxy->autoRowCategories();
-        bool generateColumns = m_proxy->autoColumnCategories();
-
-        QStringList rowList;
-        QStringList columnList;
-        // For detecting duplicates in categories generation, using QHashes should
-        // be faster than simple QStringList::contains() check.
-        QHash<QString, bool> rowListHash;
-        QHash<QString, bool> columnListHash;
-
-        bool cumulative = m_proxy->multiMatchBehavior()
-                              == QItemModelSurfaceDataProxy::MultiMatchBehavior::Average
-                          || m_proxy->multiMatchBehavior()
-                                 == QItemModelSurfaceDataProxy::MultiMatchBehavior::CumulativeY;
-        bool average = m_proxy->multiMatchBehavior()
-                       == QItemModelSurfaceDataProxy::MultiMatchBehavior::Average;
-        bool takeFirst = m_proxy->multiMatchBehavior()
-                         == QItemModelSurfaceDataProxy::MultiMatchBehavior::First;
-        QHash<QString, QHash<QString, int>> *matchCountMap = 0;
-        if (cumulative)
-            matchCountMap = new QHash<QString, QHash<QString, int>>;
-
-        // Sort values into rows and columns
-        typedef QHash<QString, QVector3D> ColumnValueMap;
-        QHash<QString, ColumnValueMap> itemValueMap;
-        for (int i = 0; i < rowCount; i++) {
-            for (int j = 0; j < columnCount; j++) {
-                QModelIndex index = m_itemModel->index(i, j);
-                QString rowRoleStr = index.data(rowRole).toString();
-                if (haveRowPattern)
-                    rowRoleStr.replace(rowPattern, rowReplace);
-                QString columnRoleStr = index.data(columnRole).toString();
-                if (haveColPattern)
-                    columnRoleStr.replace(colPattern, colReplace);
-                QVariant xValueVar = index.data(m_xPosRole);
-                QVariant yValueVar = index.data(m_yPosRole);
-                QVariant zValueVar = index.data(m_zPosRole);
-                float xPos;
-                float yPos;
-                float zPos;
-                if (m_haveXPosPattern)
-                    xPos = xValueVar.toString().replace(m_xPosPattern, m_xPosReplace).toFloat();
-                else
-                    xPos = xValueVar.toFloat();
-                if (m_haveYPosPattern)
-                    yPos = yValueVar.toString().replace(m_yPosPattern, m_yPosReplace).toFloat();
-                else
-                    yPos = yValueVar.toFloat();
-                if (m_haveZPosPattern)
-                    zPos = zValueVar.toString().replace(m_zPosPattern, m_zPosReplace).toFloat();
-                else
-                    zPos = zValueVar.toFloat();
-
-                QVector3D itemPos(xPos, yPos, zPos);
-
-                if (cumulative)
-                    (*matchCountMap)[rowRoleStr][columnRoleStr]++;
-
-                if (cumulative) {
-                    itemValueMap[rowRoleStr][columnRoleStr] += itemPos;
-                } else {
-                    if (takeFirst && itemValueMap.contains(rowRoleStr)) {
-                        if (itemValueMap.value(rowRoleStr).contains(columnRoleStr))
-                            continue; // We already have a value for this row/column combo
-                    }
-                    itemValueMap[rowRoleStr][columnRoleStr] = itemPos;
-                }
+            m_zPosRole = job.rowRole;
+        setFetchRoles({job.rowRole, job.columnRole, m_xPosRole, m_yPosRole, m_zPosRole});
 
-                if (generateRows && !rowListHash.value(rowRoleStr, false)) {
-                    rowListHash.insert(rowRoleStr, true);
-                    rowList << rowRoleStr;
-                }
-                if (generateColumns && !columnListHash.value(columnRoleStr, false)) {
-                    columnListHash.insert(columnRoleStr, true);
-                    columnList << columnRoleStr;
-                }
-            }
-        }
-
-        if (generateRows)
-            m_proxy->d_func()->m_rowCategories = rowList;
-        else
-            rowList = m_proxy->rowCategories();
-
-        if (generateColumns)
-            m_proxy->d_func()->m_columnCategories = columnList;
-        else
-            columnList = m_proxy->columnCategories();
+        job.generateRows = m_proxy->autoRowCategories();
+        job.generateColumns = m_proxy->autoColumnCategories();
+        if (!job.generateRows)
+            job.rowCategories = m_proxy->rowCategories();
+        if (!job.generateColumns)
+            job.columnCategories = m_proxy->columnCategories();
+        job.multiMatchBehavior = m_proxy->multiMatchBehavior();
+    }
+    job.xPosExtractor = m_xPosExtractor;
+    job.yPosExtractor = m_yPosExtractor;
+    job.zPosExtractor = m_zPosExtractor;
+    job.xPosRole = m_xPosRole;
+    job.yPosRole = m_yPosRole;
+    job.zPosRole = m_zPosRole;
 
-        // If dimensions have changed, recreate the array
-        if (m_proxyArray.data() != m_proxy->series()->dataArray().data()
-            || columnList.size() != m_proxy->columnCount()
-            || rowList.size() != m_proxyArray.size()) {
-            m_proxyArray.clear();
-            m_proxyArray.reserve(rowList.size());
-            for (int i = 0; i < rowList.size(); i++)
-                m_proxyArray.append(QSurfaceDataRow(columnList.size()));
-        }
-        // Create data array from itemValueMap
-        for (int i = 0; i < rowList.size(); i++) {
-            QString rowKey = rowList.at(i);
-            QSurfaceDataRow &newProxyRow = m_proxyArray[i];
-            for (int j = 0; j < columnList.size(); j++) {
-                QVector3D &itemPos = itemValueMap[rowKey][columnList.at(j)];
-                if (cumulative) {
-                    float divisor = float((*matchCountMap)[rowKey][columnList.at(j)]);
-                    if (divisor) {
-                        if (average) {
-                            itemPos /= divisor;
-                        } else { // cumulativeY
-                            itemPos.setX(itemPos.x() / divisor);
-                            itemPos.setZ(itemPos.z() / divisor);
-                        }
-                    }
-                }
-                newProxyRow[j].setPosition(itemPos);
+    if (m_proxy->resolveInBackground()) {
+        // The model can only be accessed on this thread, so copy its data for the worker
+        const qsizetype roleCount = m_fetchRoleData.size();
+        QList<QModelRoleData> snapshot;
+        snapshot.reserve(qsizetype(job.rowCount) * job.columnCount * roleCount);
+        for (int i = 0; i < job.rowCount; i++) {
+            for (int j = 0; j < job.columnCount; j++) {
+                for (const QModelRoleData &data : fetchRoles(m_itemModel->index(i, j)))
+                    snapshot.append(data);
             }
         }
 
-        delete matchCountMap;
+        auto promise = std::make_shared<QPromise<ResolveJob>>();
+        m_resolveWatcher.setFuture(promise->future());
+        m_resolving = true;
+        QThreadPool::globalInstance()->start(
+            [promise, job = std::move(job), snapshot = std::move(snapshot), roleCount]() mutable {
+                promise->start();
+                auto fetch = [&](int row, int column) {
+                    const qsizetype index = qsizetype(row) * job.columnCount + column;
+                    return QModelRoleDataSpan(snapshot.data() + index * roleCount, roleCount);
+                };
+                if (buildArray(job, fetch, [&]() { return promise->isCanceled(); }))
+                    promise->addResult(std::move(job));
+                promise->finish();
+            });
+    } else {
+        // Reuse the array if the series still has it
+        if (m_proxyArray.data() == m_proxy->series()->dataArray().data())
+            job.array = std::move(m_proxyArray);
+        buildArray(
+            job,
+            [this](int row, int column) { return fetchRoles(m_itemModel->index(row, column)); },
+            []() { return false; });
+        applyResolveJob(job);
     }
-
-    m_proxy->resetArray(m_proxyArray);
 }
 
 QT_END_NAMESPACE
@@ -16,6 +16,7 @@
 
 #include "abstractitemmodelhandler_p.h"
 #include "qitemmodelsurfacedataproxy_p.h"
+#include <QtCore/QFutureWatcher>
 
 QT_BEGIN_NAMESPACE
 
@@ -34,20 +35,55 @@ public Q_SLOTS:
 protected:
     void resolveModel() override;
 
+private Q_SLOTS:
+    void handleResolveFinished();
+
+private:
+    // Everything needed to build the data array from the model data. It is filled on the
+    // GUI thread, so that the array can also be built on a worker thread.
+    struct ResolveJob
+    {
+        RoleExtractor rowExtractor;
+        RoleExtractor columnExtractor;
+        RoleExtractor xPosExtractor;
+        RoleExtractor yPosExtractor;
+        RoleExtractor zPosExtractor;
+        int rowRole = -1;
+        int columnRole = -1;
+        int xPosRole = -1;
+        int yPosRole = -1;
+        int zPosRole = -1;
+        int rowCount = 0;
+        int columnCount = 0;
+        bool useModelCategories = false;
+        bool generateRows = false;
+        bool generateColumns = false;
+        QItemModelSurfaceDataProxy::MultiMatchBehavior multiMatchBehavior
+            = QItemModelSurfaceDataProxy::MultiMatchBehavior::Last;
+        // Header positions, used with model categories when x or z role is not mapped
+        QList<float> rowPositions;
+        QList<float> columnPositions;
+        QStringList rowCategories;
+        QStringList columnCategories;
+        QSurfaceDataArray array;
+    };
+
+    template<typename Fetch, typename Canceled>
+    static bool buildArray(ResolveJob &job, Fetch fetch, Canceled canceled);
+    void applyResolveJob(ResolveJob &job);
+
+protected:
     QItemModelSurfaceDataProxy *m_proxy; // Not owned
     QSurfaceDataArray m_proxyArray;
     int m_xPosRole;
     int m_yPosRole;
     int m_zPosRole;
-    QRegularExpression m_xPosPattern;
-    QRegularExpression m_yPosPattern;
-    QRegularExpression m_zPosPattern;
-    QString m_xPosReplace;
-    QString m_yPosReplace;
-    QString m_zPosReplace;
-    bool m_haveXPosPattern;
-    bool m_haveYPosPattern;
-    bool m_haveZPosPattern;
+    RoleExtractor m_xPosExtractor;
+    RoleExtractor m_yPosExtractor;
+    RoleExtractor m_zPosExtractor;
+    QFutureWatcher<ResolveJob> m_resolveWatcher;
+    bool m_resolving;
+    bool m_resolveAgain;
 };
 
 QT_END_NAMESPACE
@@ -13,41 +13,23 @@ BarInstancing::~BarInstancing()
 QByteArray BarInstancing::getInstanceBuffer(int *instanceCount)
 {
     if (m_dirty) {
-        m_instanceData.resize(0);
-        int instanceNumber = 0;
-
-        for (int i = 0; i < m_dataArray.size(); ++i) {
-            auto item = m_dataArray.at(i);
-
-            if ((item->color.alphaF() < 1.0) || transparency())
-                setDepthSortingEnabled(true);
-            else
-                setDepthSortingEnabled(false);
-
-            QVector4D customData{};
-            customData.setX(item->heightValue);
-            if (!item->selectedBar) {
-                auto entry = calculateTableEntryFromQuaternion(item->position,
-                                                               item->scale,
-                                                               item->rotation,
-                                                               item->color,
-                                                               customData);
-                m_instanceData.append(reinterpret_cast<char *>(&entry), sizeof(entry));
-            } else {
-                // Even selected bars need to be drawn in a very small scale.
-                // If this is not done, the program can't find the selected bars in the
-                // graph and detects the wrong bars as selected ones.
-                auto entry = calculateTableEntryFromQuaternion(item->position,
-                                                               QVector3D{.001f, .001f, .001f},
-                                                               item->rotation,
-                                                               QColor(Qt::white));
-                m_instanceData.append(reinterpret_cast<char *>(&entry), sizeof(entry));
-            }
-            instanceNumber++;
-        }
-        m_instanceCount = instanceNumber;
+        m_instanceData.resize(m_dataArray.size() * sizeof(InstanceTableEntry));
+        auto entries = reinterpret_cast<InstanceTableEntry *>(m_instanceData.data());
+        for (qsizetype i = 0; i < m_dataArray.size(); ++i)
+            entries[i] = instanceEntry(i);
+        m_instanceCount = int(m_dataArray.size());
         m_dirty = false;
+    } else if (!m_dirtyIndices.isEmpty()) {
+        // Only the changed entries are recalculated, the rest of the table is kept
+        auto entries = reinterpret_cast<InstanceTableEntry *>(m_instanceData.data());
+        for (qsizetype index : std::as_const(m_dirtyIndices))
+            entries[index] = instanceEntry(index);
     }
+    m_dirtyIndices.clear();
+
+    // Depth sorting follows the color of the last bar, as all bars of a series share it
+    const bool transparentBars = !m_dataArray.isEmpty() && m_dataArray.last()->color.alphaF() < 1.0;
+    setDepthSortingEnabled(transparentBars || transparency());
 
     if (instanceCount)
         *instanceCount = m_instanceCount;
@@ -55,6 +37,27 @@ QByteArray BarInstancing::getInstanceBuffer(int *instanceCount)
     return m_instanceData;
 }
 
+QQuick3DInstancing::InstanceTableEntry BarInstancing::instanceEntry(qsizetype index) const
+{
+    const BarItemHolder *item = m_dataArray.at(index);
+    if (!item->selectedBar) {
+        QVector4D customData{};
+        customData.setX(item->heightValue);
+        return calculateTableEntryFromQuaternion(item->position,
+                                                 item->scale,
+                                                 item->rotation,
+                                                 item->color,
+                                                 customData);
+    }
+    // Even selected bars need to be drawn in a very small scale.
+    // If this is not done, the program can't find the selected bars in the
+    // graph and detects the wrong bars as selected ones.
+    return calculateTableEntryFromQuaternion(item->position,
+                                             QVector3D{.001f, .001f, .001f},
+                                             item->rotation,
+                                             QColor(Qt::white));
+}
+
 bool BarInstancing::transparency() const
 {
     return m_transparency;
@@ -69,6 +72,7 @@ void BarInstancing::clearDataArray()
 {
     m_dataArray.clear();
     m_instanceData.clear();
+    m_dirty = true;
 }
 
 void BarInstancing::markDataDirty()
@@ -77,6 +81,29 @@ void BarInstancing::markDataDirty()
     markDirty();
 }
 
+qsizetype BarInstancing::dirtyItemThreshold() const
+{
+    // Rebuild the table once a quarter of the bars has changed
+    return qMax(qsizetype(16), m_dataArray.size() / 4);
+}
+
+void BarInstancing::markDataItemDirty(qsizetype index)
+{
+    if (m_dirty)
+        return;
+
+    // Repeated marks of the same bar are recorded once
+    if (m_dirtyIndices.isEmpty() || m_dirtyIndices.last() != index) {
+        if (m_dirtyIndices.size() >= dirtyItemThreshold()) {
+            m_dirtyIndices.clear();
+            m_dirty = true;
+        } else {
+            m_dirtyIndices.append(index);
+        }
+    }
+    markDirty();
+}
+
 QList<BarItemHolder *> BarInstancing::dataArray() const
 {
     return m_dataArray;
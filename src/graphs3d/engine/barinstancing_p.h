@@ -39,6 +39,7 @@ public:
     void setDataArray(const QList<BarItemHolder *> &newDataArray);
 
     void markDataDirty();
+    void markDataItemDirty(qsizetype index);
     bool transparency() const;
     void setTransparency(bool newTransparencyValue);
 
@@ -48,10 +49,16 @@ protected:
     QByteArray getInstanceBuffer(int *instanceCount) override;
 
 private:
+    qsizetype dirtyItemThreshold() const;
+    InstanceTableEntry instanceEntry(qsizetype index) const;
+
     QByteArray m_instanceData;
     QList<BarItemHolder *> m_dataArray;
     int m_instanceCount = 0;
     bool m_dirty = true;
+    // Entries to recompute when the whole table is not dirty. Past
+    // dirtyItemThreshold() entries the whole table is rebuilt instead.
+    QList<qsizetype> m_dirtyIndices;
     bool m_transparency = false;
 };
 
@@ -8,33 +8,19 @@ ScatterInstancing::ScatterInstancing() {}
 QByteArray ScatterInstancing::getInstanceBuffer(int *instanceCount)
 {
     if (m_dirty) {
-        m_instanceData.resize(0);
-        int instanceNumber = 0;
-
-        for (int i = 0; i < m_dataArray.size(); ++i) {
-            auto item = m_dataArray.at(i);
-            float x = item.position.x();
-            float y = item.position.y();
-            float z = item.position.z();
-            QVector4D customData{};
-            if (m_rangeGradient)
-                customData.setX(m_customData.at(i));
-
-            if (item.hide) {
-                // Setting the scale to zero breaks instanced picking.
-                item.scale = {0.001f, 0.001f, 0.001f};
-            }
-            auto entry = calculateTableEntryFromQuaternion({x, y, z},
-                                                           item.scale,
-                                                           item.rotation,
-                                                           QColor(Qt::white),
-                                                           customData);
-            m_instanceData.append(reinterpret_cast<char *>(&entry), sizeof(entry));
-            instanceNumber++;
-        }
-        m_instanceCount = instanceNumber;
+        m_instanceData.resize(m_dataArray.size() * sizeof(InstanceTableEntry));
+        auto entries = reinterpret_cast<InstanceTableEntry *>(m_instanceData.data());
+        for (qsizetype i = 0; i < m_dataArray.size(); ++i)
+            entries[i] = instanceEntry(i);
+        m_instanceCount = int(m_dataArray.size());
         m_dirty = false;
+    } else if (!m_dirtyIndices.isEmpty()) {
+        // Only the changed entries are recalculated, the rest of the table is kept
+        auto entries = reinterpret_cast<InstanceTableEntry *>(m_instanceData.data());
+        for (qsizetype index : std::as_const(m_dirtyIndices))
+            entries[index] = instanceEntry(index);
     }
+    m_dirtyIndices.clear();
 
     if (instanceCount)
         *instanceCount = m_instanceCount;
@@ -42,6 +28,24 @@ QByteArray ScatterInstancing::getInstanceBuffer(int *instanceCount)
     return m_instanceData;
 }
 
+QQuick3DInstancing::InstanceTableEntry ScatterInstancing::instanceEntry(qsizetype index)
+{
+    DataItemHolder item = m_dataArray.at(index);
+    QVector4D customData{};
+    if (m_rangeGradient)
+        customData.setX(m_customData.at(index));
+
+    if (item.hide) {
+        // Setting the scale to zero breaks instanced picking.
+        item.scale = {0.001f, 0.001f, 0.001f};
+    }
+    return calculateTableEntryFromQuaternion(item.position,
+                                             item.scale,
+                                             item.rotation,
+                                             QColor(Qt::white),
+                                             customData);
+}
+
 bool ScatterInstancing::rangeGradient() const
 {
     return m_rangeGradient;
@@ -74,6 +78,29 @@ void ScatterInstancing::markDataDirty()
     markDirty();
 }
 
+qsizetype ScatterInstancing::dirtyItemThreshold() const
+{
+    // Scattered updates beyond a quarter of the table are slower than a linear rebuild
+    return qMax(qsizetype(16), m_dataArray.size() / 4);
+}
+
+void ScatterInstancing::markDataItemDirty(qsizetype index)
+{
+    if (m_dirty)
+        return;
+
+    // Hovering toggles the same item repeatedly between frames
+    if (m_dirtyIndices.isEmpty() || m_dirtyIndices.last() != index) {
+        if (m_dirtyIndices.size() >= dirtyItemThreshold()) {
+            m_dirtyIndices.clear();
+            m_dirty = true;
+        } else {
+            m_dirtyIndices.append(index);
+        }
+    }
+    markDirty();
+}
+
 const QList<DataItemHolder> &ScatterInstancing::dataArray() const
 {
     return m_dataArray;
@@ -85,25 +112,38 @@ void ScatterInstancing::setDataArray(const QList<DataItemHolder> &newDataArray)
     markDataDirty();
 }
 
+void ScatterInstancing::setDataItem(qsizetype index, const DataItemHolder &dataItem)
+{
+    Q_ASSERT(index < m_dataArray.size());
+    m_dataArray[index] = dataItem;
+    markDataItemDirty(index);
+}
+
 void ScatterInstancing::hideDataItem(qsizetype index)
 {
     unhidePreviousDataItem();
     Q_ASSERT(index < m_dataArray.size());
-    m_dataArray[index].hide = true;
+    if (!m_dataArray.at(index).hide) {
+        m_dataArray[index].hide = true;
+        markDataItemDirty(index);
+    }
     m_previousHideIndex = index;
 }
 
 void ScatterInstancing::unhidePreviousDataItem()
 {
-    if (m_previousHideIndex >= 0) {
+    if (m_previousHideIndex >= 0 && m_previousHideIndex < m_dataArray.size()) {
         m_dataArray[m_previousHideIndex].hide = false;
-        markDataDirty();
+        markDataItemDirty(m_previousHideIndex);
     }
 }
 
 void ScatterInstancing::resetVisibilty()
 {
-    for (auto &dih : m_dataArray)
-        dih.hide = false;
-    markDataDirty();
+    for (qsizetype i = 0; i < m_dataArray.size(); ++i) {
+        if (m_dataArray.at(i).hide) {
+            m_dataArray[i].hide = false;
+            markDataItemDirty(i);
+        }
+    }
 }
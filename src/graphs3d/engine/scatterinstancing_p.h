@@ -33,6 +33,7 @@ public:
 
     const QList<DataItemHolder> &dataArray() const;
     void setDataArray(const QList<DataItemHolder> &newDataArray);
+    void setDataItem(qsizetype index, const DataItemHolder &dataItem);
     void hideDataItem(qsizetype index);
     void unhidePreviousDataItem();
     void resetVisibilty();
@@ -41,12 +42,13 @@ public:
     void setCustomData(const QList<float> &newCustomData);
 
     void markDataDirty();
+    void markDataItemDirty(qsizetype index);
     bool rangeGradient() const;
     void setRangeGradient(bool newRangeGradient);
 
     void setTransparency(bool transparency);
 
-    bool isDirty() const { return m_dirty; }
+    bool isDirty() const { return m_dirty || !m_dirtyIndices.isEmpty(); }
 
     // QQuick3DInstancing interface
 
@@ -54,11 +56,17 @@ protected:
     QByteArray getInstanceBuffer(int *instanceCount) override;
 
 private:
+    qsizetype dirtyItemThreshold() const;
+    InstanceTableEntry instanceEntry(qsizetype index);
+
     QByteArray m_instanceData;
     QList<DataItemHolder> m_dataArray;
     QList<float> m_customData;
     int m_instanceCount = 0;
     bool m_dirty = true;
+    // Entries to recompute when the whole table is not dirty. Past
+    // dirtyItemThreshold() entries the whole table is rebuilt instead.
+    QList<qsizetype> m_dirtyIndices;
     bool m_rangeGradient = false;
     qsizetype m_previousHideIndex = -1;
 };
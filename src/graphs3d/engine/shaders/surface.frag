@@ -23,8 +23,7 @@ void MAIN()
         color = uniformColor;
         break;
     case 3: // Textured model
-        vec2 offsetNormalized = uvOffset * (1 / (vertCount - 1));
-        vec2 texUV = UV0 + offsetNormalized;
+        vec2 texUV = (UV0 * (vertCount - 1) * sampleStep + uvOffset) / (dataSize - 1);
         if (flipU)
             texUV.x = 1 - texUV.x;
         if (flipV)
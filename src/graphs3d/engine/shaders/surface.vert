@@ -1,6 +1,16 @@
 VARYING vec3 pos;
 VARYING vec2 UV;
 
+vec3 vertexAt(vec2 uv)
+{
+    if (heightOnly) {
+        return vec3(texture(xCoords, vec2(uv.x, 0.5)).r,
+                    texture(height, uv).r,
+                    texture(zCoords, vec2(uv.y, 0.5)).r);
+    }
+    return texture(height, uv).xyz;
+}
+
 void MAIN()
 {
     UV = UV0 * (vertCount / size);
@@ -15,12 +25,12 @@ void MAIN()
     vec2 uStep = vec2(xStep, 0.0);
     vec2 vStep = vec2(0.0, yStep);
 
-    vec3 v = texture(height, UV).xyz;
+    vec3 v = vertexAt(UV);
 
-    vec3 vRight = texture(height, UV + uStep).xyz;
-    vec3 vLeft = texture(height, UV - uStep).xyz;
-    vec3 vUp = texture(height, UV + vStep).xyz;
-    vec3 vDown = texture(height, UV - vStep).xyz;
+    vec3 vRight = vertexAt(UV + uStep);
+    vec3 vLeft = vertexAt(UV - uStep);
+    vec3 vUp = vertexAt(UV + vStep);
+    vec3 vDown = vertexAt(UV - vStep);
 
     vec3 tangent = vLeft - vRight;
     vec3 bitangent = vUp - vDown;
@@ -1,6 +1,12 @@
 void MAIN()
 {
     vec2 UV = UV0 * (vertices / range);
-    VERTEX = texture(height, UV).rgb;
+    if (heightOnly) {
+        VERTEX = vec3(texture(xCoords, vec2(UV.x, 0.5)).r,
+                      texture(height, UV).r,
+                      texture(zCoords, vec2(UV.y, 0.5)).r);
+    } else {
+        VERTEX = texture(height, UV).rgb;
+    }
     POSITION = MODELVIEWPROJECTION_MATRIX * vec4(VERTEX, 1.0);
 }
@@ -5,6 +5,14 @@ VARYING vec3 rayDir;
 // Rays traveling shorter distances apply a fraction. This is used to normalize the alpha over
 // entire volume, regardless of texture dimensions
 const highp float alphaThicknesses = 32.0;
+// Rays stop once the remaining transparency is too small to visibly change the result
+const highp float minOpacity = 0.002;
+
+// Maps a scalar texel value through the value window onto the color table
+vec4 colorTableColor(float value)
+{
+    return textureLod(colorSampler, vec2(clamp((value - valueWindow.x) * valueWindow.y, 0.0, 1.0), 0), 0);
+}
 
 void MAIN() {
     vec3 rayStart = pos;
@@ -55,38 +63,57 @@ void MAIN() {
     highp float extraAlphaMultiplier = fullDist * alphaThicknesses * alphaMultiplier;
 
     // nextEdges vector indicates the next edges of the texel boundaries along each axis that
-    // the ray is about to cross. The first edges are offset by a fraction of a texel to
-    // avoid artifacts from rounding errors later.
-    highp vec3 nextEdges = vec3(floor(curPos.x / textureDimensions.x) * textureDimensions.x,
-                                floor(curPos.y / textureDimensions.y) * textureDimensions.y,
-                                floor(curPos.z / textureDimensions.z) * textureDimensions.z);
-
+    // the ray is about to cross. The edges are offset by a fraction of a texel to
+    // avoid artifacts from rounding errors later. Brick edges are offset the same way.
     highp vec3 textureSteps = textureDimensions;
     highp vec3 textureOffset = textureDimensions * 0.001;
+    highp vec3 edgeOffsets;
+    highp vec3 brickEdgeOffsets;
     if (ray.x > 0) {
-        nextEdges.x += textureDimensions.x + textureOffset.x;
+        edgeOffsets.x = textureDimensions.x + textureOffset.x;
+        brickEdgeOffsets.x = brickDimensions.x + textureOffset.x;
     } else {
-        nextEdges.x -= textureOffset.x;
+        edgeOffsets.x = -textureOffset.x;
+        brickEdgeOffsets.x = -textureOffset.x;
         textureSteps.x = -textureDimensions.x;
     }
     if (ray.y > 0) {
-        nextEdges.y += textureDimensions.y + textureOffset.y;
+        edgeOffsets.y = textureDimensions.y + textureOffset.y;
+        brickEdgeOffsets.y = brickDimensions.y + textureOffset.y;
     } else {
-        nextEdges.y -= textureOffset.y;
+        edgeOffsets.y = -textureOffset.y;
+        brickEdgeOffsets.y = -textureOffset.y;
         textureSteps.y = -textureDimensions.y;
     }
     if (ray.z > 0) {
-        nextEdges.z += textureDimensions.z + textureOffset.z;
+        edgeOffsets.z = textureDimensions.z + textureOffset.z;
+        brickEdgeOffsets.z = brickDimensions.z + textureOffset.z;
     } else {
-        nextEdges.z -= textureOffset.z;
+        edgeOffsets.z = -textureOffset.z;
+        brickEdgeOffsets.z = -textureOffset.z;
         textureSteps.z = -textureDimensions.z;
     }
+    highp vec3 nextEdges = floor(curPos / textureDimensions) * textureDimensions + edgeOffsets;
 
     // Raytrace into volume, need to sample pixels along the eye ray until we hit opacity 1
     for (int i = 0; i < sampleCount; i++) {
+        // Bricks without any visible texels are crossed in a single step
+        if (textureLod(occupancySampler, curPos * occupancyScale, 0).r == 0.0) {
+            highp vec3 brickEdges = floor(curPos / brickDimensions) * brickDimensions
+                    + brickEdgeOffsets;
+            highp vec3 brickDelta = abs(brickEdges - curPos) * invAbsRay;
+            highp float skipSize = min(brickDelta.x, min(brickDelta.y, brickDelta.z));
+            curPos += skipSize * ray;
+            curLen += skipSize;
+            if (curLen >= 1.0)
+                break;
+            nextEdges = floor(curPos / textureDimensions) * textureDimensions + edgeOffsets;
+            continue;
+        }
+
         curColor = textureLod(textureSampler, curPos, 0);
         if (color8Bit != 0)
-            curColor = textureLod(colorSampler, vec2(curColor.r, 0), 0);
+            curColor = colorTableColor(curColor.r);
 
         // Find which dimension has least to go to figure out the next step distance
         highp vec3 delta = abs(nextEdges - curPos);
@@ -127,7 +154,7 @@ void MAIN() {
             destColor.rgb += curRgb;
         }
 
-        if (curLen >= 1.0 || totalOpacity <= 0.0)
+        if (curLen >= 1.0 || totalOpacity <= minOpacity)
             break;
     }
 
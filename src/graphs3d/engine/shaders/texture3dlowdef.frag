@@ -6,6 +6,14 @@ VARYING vec3 rayDir;
 // entire volume, regardless of texture dimensions
 const highp float alphaThicknesses = 32.0;
 const highp float SQRT3 = 1.73205081;
+// Rays stop once the remaining transparency is too small to visibly change the result
+const highp float minOpacity = 0.002;
+
+// Maps a scalar texel value through the value window onto the color table
+vec4 colorTableColor(float value)
+{
+    return textureLod(colorSampler, vec2(clamp((value - valueWindow.x) * valueWindow.y, 0.0, 1.0), 0), 0);
+}
 
 void MAIN() {
     vec3 rayStart = pos;
@@ -42,6 +50,16 @@ void MAIN() {
     highp float fullDist = length(ray);
     highp float stepSize = SQRT3 / sampleCount;
     highp vec3 step = (SQRT3 * normalize(ray)) / sampleCount;
+    highp vec3 invAbsStep = 1.0 / abs(step);
+
+    // Brick edges are offset by a fraction of a texel to avoid rounding errors when skipping
+    highp vec3 textureOffset = textureDimensions * 0.001;
+    highp vec3 brickEdgeOffsets = vec3(step.x > 0 ? brickDimensions.x + textureOffset.x
+                                                  : -textureOffset.x,
+                                       step.y > 0 ? brickDimensions.y + textureOffset.y
+                                                  : -textureOffset.y,
+                                       step.z > 0 ? brickDimensions.z + textureOffset.z
+                                                  : -textureOffset.z);
 
     rayStart += (step * 0.001);
 
@@ -57,9 +75,24 @@ void MAIN() {
 
     // Raytrace into volume, need to sample pixels along the eye ray until we hit opacity 1
     for (int i = 0; i < sampleCount; i++) {
+        // Bricks without any visible texels are crossed with whole steps, so that the samples
+        // after the brick stay where they would be without skipping
+        if (textureLod(occupancySampler, curPos * occupancyScale, 0).r == 0.0) {
+            highp vec3 brickEdges = floor(curPos / brickDimensions) * brickDimensions
+                    + brickEdgeOffsets;
+            highp vec3 brickDelta = abs(brickEdges - curPos) * invAbsStep;
+            highp float skipSteps = max(ceil(min(brickDelta.x, min(brickDelta.y, brickDelta.z))),
+                                        1.0);
+            curPos += step * skipSteps;
+            curLen += stepSize * skipSteps;
+            if (curLen >= fullDist)
+                break;
+            continue;
+        }
+
         curColor = textureLod(textureSampler, curPos, 0);
         if (color8Bit != 0)
-            curColor = textureLod(colorSampler, vec2(curColor.r, 0), 0);
+            curColor = colorTableColor(curColor.r);
 
         if (curColor.a >= 0.0) {
             if (curColor.a == 1.0 && (preserveOpacity == 1 || alphaMultiplier >= 1.0))
@@ -81,7 +114,7 @@ void MAIN() {
         }
         curPos += step;
         curLen += stepSize;
-        if (curLen >= fullDist || totalOpacity <= 0.0)
+        if (curLen >= fullDist || totalOpacity <= minOpacity)
             break;
     }
 
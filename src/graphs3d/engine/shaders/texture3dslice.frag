@@ -5,6 +5,12 @@ const highp vec3 xPlaneNormal = vec3(1.0, 0, 0);
 const highp vec3 yPlaneNormal = vec3(0, 1.0, 0);
 const highp vec3 zPlaneNormal = vec3(0, 0, 1.0);
 
+// Maps a scalar texel value through the value window onto the color table
+vec4 colorTableColor(float value)
+{
+    return textureLod(colorSampler, vec2(clamp((value - valueWindow.x) * valueWindow.y, 0.0, 1.0), 0), 0);
+}
+
 void MAIN() {
     // Find out where ray intersects the slice planes
     vec3 normRayDir = normalize(rayDir);
@@ -77,7 +83,7 @@ void MAIN() {
             texelVec = 0.5 * (texelVec + 1.0);
             curColor = textureLod(textureSampler, texelVec, 0);
             if (color8Bit != 0)
-                curColor = textureLod(colorSampler, vec2(curColor.r, 0), 0);
+                curColor = colorTableColor(curColor.r);
 
             if (curColor.a > 0.0) {
                 curAlpha = curColor.a;
@@ -97,7 +103,7 @@ void MAIN() {
                 texelVec = 0.5 * (texelVec + 1.0);
                 curColor = textureLod(textureSampler, texelVec, 0);
                 if (color8Bit != 0)
-                    curColor = textureLod(colorSampler, vec2(curColor.r, 0), 0);
+                    curColor = colorTableColor(curColor.r);
                 if (curColor.a > 0.0) {
                     if (curColor.a == 1.0 && preserveOpacity != 0)
                         curAlpha = 1.0;
@@ -117,7 +123,7 @@ void MAIN() {
                     curColor = textureLod(textureSampler, texelVec, 0);
                     if (curColor.a > 0.0) {
                         if (color8Bit != 0)
-                            curColor = textureLod(colorSampler, vec2(curColor.r, 0), 0);
+                            curColor = colorTableColor(curColor.r);
                         if (curColor.a == 1.0 && preserveOpacity != 0)
                             curAlpha = 1.0;
                         else
@@ -2294,9 +2294,14 @@ void QQuickGraphsBars::resetClickedStatus()
 
     if (optimizationHint() == QtGraphs3D::OptimizationHint::Default) {
         for (const auto barList : std::as_const(m_barModelsMap)) {
-            QList<BarItemHolder *> barItemList = barList->at(0)->instancing->dataArray();
-            for (auto bih : barItemList)
-                bih->selectedBar = false;
+            BarInstancing *instancing = barList->at(0)->instancing;
+            const QList<BarItemHolder *> barItemList = instancing->dataArray();
+            for (qsizetype i = 0; i < barItemList.size(); ++i) {
+                if (barItemList.at(i)->selectedBar) {
+                    barItemList.at(i)->selectedBar = false;
+                    instancing->markDataItemDirty(i);
+                }
+            }
         }
     }
 
@@ -2518,7 +2523,8 @@ void QQuickGraphsBars::createBarItemHolders(QBar3DSeries *series,
         multiInstancing = barList.at(0)->multiSelectionInstancing;
     }
 
-    for (const auto bih : std::as_const(barItemList)) {
+    for (qsizetype i = 0; i < barItemList.size(); ++i) {
+        BarItemHolder *bih = barItemList.at(i);
         QQuickGraphsBars::SelectionType selectionType = isSelected(bih->coord.x(),
                                                                    bih->coord.y(),
                                                                    series);
@@ -2533,8 +2539,10 @@ void QQuickGraphsBars::createBarItemHolders(QBar3DSeries *series,
                                      false,
                                      barList.at(0)->texture,
                                      QColor(Qt::white));
-            if (!slice)
+            if (!slice && !bih->selectedBar) {
                 bih->selectedBar = true;
+                barList.at(0)->instancing->markDataItemDirty(i);
+            }
             selectedModel->setVisible(visible);
             BarItemHolder *selectedBih = new BarItemHolder();
             selectedBih->selectedBar = false;
@@ -2587,8 +2595,10 @@ void QQuickGraphsBars::createBarItemHolders(QBar3DSeries *series,
                                      true,
                                      barList.at(0)->texture,
                                      QColor(Qt::white));
-            if (!slice)
+            if (!slice && !bih->selectedBar) {
                 bih->selectedBar = true;
+                barList.at(0)->instancing->markDataItemDirty(i);
+            }
             multiSelectedModel->setVisible(visible);
             BarItemHolder *selectedBih = new BarItemHolder();
             selectedBih->selectedBar = false;
@@ -13,6 +13,7 @@
 #include "qcustom3ditem_p.h"
 #include "qcustom3dlabel.h"
 #include "qcustom3dvolume.h"
+#include "qcustom3dvolume_p.h"
 #include "qgraphsinputhandler_p.h"
 #include "qgraphstheme.h"
 #include "qvalue3daxis.h"
@@ -30,6 +31,8 @@
 #include <QtQuick3D/private/qquick3dprincipledmaterial_p.h>
 #include <QtQuick3D/private/qquick3drepeater_p.h>
 
+#include <limits>
+
 #if defined(Q_OS_IOS)
 #include <QtCore/QTimer>
 #endif
@@ -42,6 +45,8 @@ QT_BEGIN_NAMESPACE
 
 constexpr float doublePi = static_cast<float>(M_PI) * 2.0f;
 constexpr float polarRoundness = 64.0f;
+// Edge length of the volume bricks that empty space skipping works with, in texels
+constexpr int volumeBrickSize = 8;
 
 /*!
  * \qmltype GraphsItem3D
@@ -2330,6 +2335,7 @@ void QQuickGraphsItem::synchData()
         return;
 
     m_renderPending = false;
+    ++m_synchCounts.synchs;
 
     if (m_changeTracker.selectionModeChanged) {
         updateSelectionMode(selectionMode());
@@ -2647,6 +2653,8 @@ void QQuickGraphsItem::synchData()
         axisDirty = true;
     }
 
+    // Custom volumes depend on the scene scale and the projection, and on their own properties
+    bool customVolumesDirty = axisDirty;
     if (axisDirty) {
         QQmlListReference materialsRef(m_background, "materials");
         if (!materialsRef.size()) {
@@ -2655,16 +2663,9 @@ void QQuickGraphsItem::synchData()
             bgMat->setParent(m_background);
             materialsRef.append(bgMat);
         }
-        if (m_gridLineType == QtGraphs3D::GridLineType::Shader)
-            updateGridLineType();
-        else
-            updateGrid();
-        updateLabels();
+        updateGridAndLabels();
         updateCustomData();
-        if (m_sliceView && isSliceEnabled()) {
-            updateSliceGrid();
-            updateSliceLabels();
-        }
+        ++m_synchCounts.customData;
         m_gridUpdated = true;
     }
 
@@ -2674,6 +2675,7 @@ void QQuickGraphsItem::synchData()
     }
     if (m_changeTracker.labelMarginChanged) {
         updateLabels();
+        ++m_synchCounts.labels;
         m_changeTracker.labelMarginChanged = false;
     }
 
@@ -2720,9 +2722,8 @@ void QQuickGraphsItem::synchData()
         }
     }
 
-    bool forceUpdateCustomVolumes = false;
     if (m_changeTracker.projectionChanged) {
-        forceUpdateCustomVolumes = true;
+        customVolumesDirty = true;
         bool useOrtho = isOrthoProjection();
         if (useOrtho)
             setCamera(m_oCamera);
@@ -2914,6 +2915,7 @@ void QQuickGraphsItem::synchData()
         m_titleLabelZ->setProperty("labelFont", font);
         m_itemLabel->setProperty("labelFont", font);
         updateLabels();
+        ++m_synchCounts.labels;
 
         if (m_sliceView && isSliceEnabled()) {
             changeLabelFont(m_sliceHorizontalLabelRepeater, font);
@@ -3001,29 +3003,30 @@ void QQuickGraphsItem::synchData()
     }
 
     if (isCustomDataDirty()) {
-        forceUpdateCustomVolumes = true;
+        customVolumesDirty = true;
         updateCustomData();
+        ++m_synchCounts.customData;
         setCustomDataDirty(false);
     }
 
     if (m_changedSeriesList.size()) {
-        forceUpdateCustomVolumes = true;
         updateGraph();
+        ++m_synchCounts.graph;
         m_changedSeriesList.clear();
     }
 
     if (m_isSeriesVisualsDirty) {
-        forceUpdateCustomVolumes = true;
-        if (m_gridLineType == QtGraphs3D::GridLineType::Shader)
-            updateGridLineType();
-        else
-            updateGrid();
-        updateLabels();
-        if (m_sliceView && isSliceEnabled()) {
+        // Series visuals only reach the grid and the labels through the scene scale, which
+        // some graphs recalculate when their visuals change
+        if (m_scaleWithBackground != m_gridSceneScale) {
+            updateGridAndLabels();
+            customVolumesDirty = true;
+        } else if (m_sliceView && isSliceEnabled()) {
             updateSliceGrid();
             updateSliceLabels();
         }
         updateGraph();
+        ++m_synchCounts.graph;
         m_isSeriesVisualsDirty = false;
     }
 
@@ -3032,25 +3035,47 @@ void QQuickGraphsItem::synchData()
             updateGridLineType();
         else
             updateGrid();
+        ++m_synchCounts.grid;
     }
 
     if (m_isDataDirty) {
-        forceUpdateCustomVolumes = true;
         updateGraph();
+        ++m_synchCounts.graph;
         m_isDataDirty = false;
     }
 
     if (m_sliceActivatedChanged)
         toggleSliceGraph();
 
-    if (isCustomItemDirty() || forceUpdateCustomVolumes)
+    if (isCustomItemDirty() || customVolumesDirty) {
         updateCustomVolumes();
+        ++m_synchCounts.customVolumes;
+        setCustomItemDirty(false);
+    }
 
     if (m_measureFps)
         QQuickItem::update();
 
-    if (m_labelsNeedupdate)
+    if (m_labelsNeedupdate) {
         updateLabels();
+        ++m_synchCounts.labels;
+    }
+}
+
+void QQuickGraphsItem::updateGridAndLabels()
+{
+    if (m_gridLineType == QtGraphs3D::GridLineType::Shader)
+        updateGridLineType();
+    else
+        updateGrid();
+    updateLabels();
+    if (m_sliceView && isSliceEnabled()) {
+        updateSliceGrid();
+        updateSliceLabels();
+    }
+    m_gridSceneScale = m_scaleWithBackground;
+    ++m_synchCounts.grid;
+    ++m_synchCounts.labels;
 }
 
 void QQuickGraphsItem::updateGrid()
@@ -4265,46 +4290,80 @@ void QQuickGraphsItem::updateSliceItemLabel(const QString &label, QVector3D posi
     m_sliceItemLabel->setScale(fontScaled);
 }
 
+static QQuick3DTextureData::Format volumeTextureFormat(QImage::Format format)
+{
+    switch (format) {
+    case QImage::Format_Indexed8:
+        return QQuick3DTextureData::R8;
+    case QImage::Format_Grayscale16:
+        return QQuick3DTextureData::R16;
+    default:
+        return QQuick3DTextureData::RGBA8;
+    }
+}
+
 void QQuickGraphsItem::createVolumeMaterial(QCustom3DVolume *volume, Volume &volumeItem)
 {
-    if (volumeItem.texture)
-        volumeItem.texture->deleteLater();
-    volumeItem.texture = new QQuick3DTexture();
-    auto texture = volumeItem.texture;
-
-    texture->setParent(this);
-    texture->setMinFilter(QQuick3DTexture::Filter::Nearest);
-    texture->setMagFilter(QQuick3DTexture::Filter::Nearest);
-    texture->setHorizontalTiling(QQuick3DTexture::TilingMode::ClampToEdge);
-    texture->setVerticalTiling(QQuick3DTexture::TilingMode::ClampToEdge);
-
-    if (volumeItem.textureData)
-        volumeItem.textureData->deleteLater();
-    volumeItem.textureData = new QQuick3DTextureData();
-    auto textureData = volumeItem.textureData;
-
-    int color8Bit = (volume->textureFormat() == QImage::Format_Indexed8) ? 1 : 0;
-
-    textureData->setParent(texture);
-    textureData->setParentItem(texture);
-    textureData->setSize(QSize(volume->textureWidth(), volume->textureHeight()));
-    textureData->setDepth(volume->textureDepth());
-    if (color8Bit)
-        textureData->setFormat(QQuick3DTextureData::R8);
-    else
-        textureData->setFormat(QQuick3DTextureData::RGBA8);
-    textureData->setTextureData(
-        QByteArray::fromRawData(reinterpret_cast<const char *>(volume->textureData()->constData()),
-                                volume->textureData()->size()));
-    texture->setTextureData(textureData);
-
-    QObject::connect(volume, &QCustom3DVolume::textureDataChanged, this, [this, volume] {
-        m_customVolumes[volume].updateTextureData = true;
-    });
+    // Scalar formats are mapped to colors through the color table in the shader
+    const bool useColorTable = volume->textureFormat() != QImage::Format_ARGB32;
+
+    // The material is recreated when switching shaders, but the textures stay valid, so
+    // they are created only once to avoid allocating and uploading the volume again.
+    if (!volumeItem.texture) {
+        volumeItem.texture = new QQuick3DTexture();
+        auto texture = volumeItem.texture;
+
+        texture->setParent(this);
+        texture->setMinFilter(QQuick3DTexture::Filter::Nearest);
+        texture->setMagFilter(QQuick3DTexture::Filter::Nearest);
+        texture->setHorizontalTiling(QQuick3DTexture::TilingMode::ClampToEdge);
+        texture->setVerticalTiling(QQuick3DTexture::TilingMode::ClampToEdge);
+
+        volumeItem.textureData = new QQuick3DTextureData();
+        auto textureData = volumeItem.textureData;
+
+        textureData->setParent(texture);
+        textureData->setParentItem(texture);
+        textureData->setSize(QSize(volume->textureWidth(), volume->textureHeight()));
+        textureData->setDepth(volume->textureDepth());
+        textureData->setFormat(volumeTextureFormat(volume->textureFormat()));
+        textureData->setTextureData(
+            QByteArray::fromRawData(reinterpret_cast<const char *>(volume->textureData()->constData()),
+                                    volume->textureData()->size()));
+        texture->setTextureData(textureData);
+
+        // The data was just taken as a whole, so the changes made so far are covered
+        bool wholeTexture;
+        volume->d_func()->takeDirtyTextureBox(&wholeTexture);
+
+        QObject::connect(volume, &QCustom3DVolume::textureDataChanged, this, [this, volume] {
+            m_customVolumes[volume].updateTextureData = true;
+        });
+    }
+
+    if (!volumeItem.occupancyTexture) {
+        volumeItem.occupancyTexture = new QQuick3DTexture();
+        auto occupancyTexture = volumeItem.occupancyTexture;
+
+        occupancyTexture->setParent(this);
+        occupancyTexture->setMinFilter(QQuick3DTexture::Filter::Nearest);
+        occupancyTexture->setMagFilter(QQuick3DTexture::Filter::Nearest);
+        occupancyTexture->setHorizontalTiling(QQuick3DTexture::TilingMode::ClampToEdge);
+        occupancyTexture->setVerticalTiling(QQuick3DTexture::TilingMode::ClampToEdge);
 
-    if (color8Bit) {
-        if (volumeItem.colorTexture)
-            volumeItem.colorTexture->deleteLater();
+        volumeItem.occupancyTextureData = new QQuick3DTextureData();
+        auto occupancyTextureData = volumeItem.occupancyTextureData;
+
+        occupancyTextureData->setParent(occupancyTexture);
+        occupancyTextureData->setParentItem(occupancyTexture);
+        occupancyTextureData->setFormat(QQuick3DTextureData::R8);
+        occupancyTexture->setTextureData(occupancyTextureData);
+
+        updateVolumeBrickRanges(volume, volumeItem);
+        updateVolumeOccupancy(volume, volumeItem);
+    }
+
+    if (useColorTable && !volumeItem.colorTexture) {
         volumeItem.colorTexture = new QQuick3DTexture();
         auto colorTexture = volumeItem.colorTexture;
 
@@ -4325,8 +4384,6 @@ void QQuickGraphsItem::createVolumeMaterial(QCustom3DVolume *volume, Volume &vol
                 QByteArray::fromRawData(reinterpret_cast<const char *>(&shifted), sizeof(shifted)));
         }
 
-        if (volumeItem.colorTextureData)
-            volumeItem.colorTextureData->deleteLater();
         volumeItem.colorTextureData = new QQuick3DTextureData();
         auto colorTextureData = volumeItem.colorTextureData;
 
@@ -4358,7 +4415,7 @@ void QQuickGraphsItem::createVolumeMaterial(QCustom3DVolume *volume, Volume &vol
     auto textureSampler = textureSamplerVariant.value<QQuick3DShaderUtilsTextureInput *>();
     textureSampler->setTexture(volumeItem.texture);
 
-    if (color8Bit) {
+    if (useColorTable) {
         auto colorSamplerVariant = material->property("colorSampler");
         auto colorSampler = colorSamplerVariant.value<QQuick3DShaderUtilsTextureInput *>();
         colorSampler->setTexture(volumeItem.colorTexture);
@@ -4369,10 +4426,207 @@ void QQuickGraphsItem::createVolumeMaterial(QCustom3DVolume *volume, Volume &vol
                                     1.0f / float(volume->textureHeight()),
                                     1.0f / float(volume->textureDepth())));
 
-    materialsRef.append(material);
-
     volumeItem.useHighDefShader = volume->useHighDefShader();
     volumeItem.drawSlices = volume->drawSlices() && m_validVolumeSlice;
+
+    if (!volumeItem.drawSlices) {
+        auto occupancySamplerVariant = material->property("occupancySampler");
+        auto occupancySampler = occupancySamplerVariant.value<QQuick3DShaderUtilsTextureInput *>();
+        occupancySampler->setTexture(volumeItem.occupancyTexture);
+        setVolumeBrickProperties(material, volume, volumeItem);
+    }
+
+    materialsRef.append(material);
+}
+
+// Resets the bricks in [fromX, toX) x [fromY, toY) x [fromZ, toZ) and rescans the texels they cover
+static void scanVolumeBricks(const QCustom3DVolume *volume,
+                             quint16 *rangeData,
+                             int bricksX,
+                             int bricksY,
+                             int fromX,
+                             int toX,
+                             int fromY,
+                             int toY,
+                             int fromZ,
+                             int toZ)
+{
+    for (int bz = fromZ; bz < toZ; ++bz) {
+        for (int by = fromY; by < toY; ++by) {
+            quint16 *range = rangeData + ((qsizetype(bz) * bricksY + by) * bricksX + fromX) * 2;
+            for (int bx = fromX; bx < toX; ++bx) {
+                *range++ = std::numeric_limits<quint16>::max();
+                *range++ = 0;
+            }
+        }
+    }
+
+    const int dataWidth = volume->textureDataWidth();
+    const qsizetype frameSize = qsizetype(dataWidth) * volume->textureHeight();
+    const int startX = fromX * volumeBrickSize;
+    const int endX = qMin(toX * volumeBrickSize, volume->textureWidth());
+    const int endY = qMin(toY * volumeBrickSize, volume->textureHeight());
+    const int endZ = qMin(toZ * volumeBrickSize, volume->textureDepth());
+
+    // ARGB32 texels are ranged by their alpha, scalar formats by their value
+    const QImage::Format format = volume->textureFormat();
+    const uchar *data = volume->textureData()->constData();
+    for (int z = fromZ * volumeBrickSize; z < endZ; ++z) {
+        for (int y = fromY * volumeBrickSize; y < endY; ++y) {
+            const uchar *line = data + z * frameSize + qsizetype(y) * dataWidth;
+            quint16 *rowRanges = rangeData
+                                 + ((qsizetype(z / volumeBrickSize) * bricksY)
+                                    + y / volumeBrickSize)
+                                       * bricksX * 2;
+            for (int x = startX; x < endX; ++x) {
+                quint16 value;
+                if (format == QImage::Format_Grayscale16)
+                    value = reinterpret_cast<const quint16 *>(line)[x];
+                else if (format == QImage::Format_Indexed8)
+                    value = line[x];
+                else
+                    value = quint16(qAlpha(reinterpret_cast<const QRgb *>(line)[x]));
+                quint16 *range = rowRanges + (x / volumeBrickSize) * 2;
+                range[0] = qMin(range[0], value);
+                range[1] = qMax(range[1], value);
+            }
+        }
+    }
+}
+
+void QQuickGraphsItem::updateVolumeBrickRanges(QCustom3DVolume *volume, Volume &volumeItem)
+{
+    const int width = volume->textureWidth();
+    const int height = volume->textureHeight();
+    const int depth = volume->textureDepth();
+    const qsizetype frameSize = qsizetype(volume->textureDataWidth()) * height;
+    const QList<uchar> *data = volume->textureData();
+
+    volumeItem.updateOccupancy = true;
+    if (!data || width <= 0 || height <= 0 || depth <= 0 || data->size() < frameSize * depth) {
+        volumeItem.brickRanges.clear();
+        volumeItem.bricksX = 0;
+        volumeItem.bricksY = 0;
+        volumeItem.bricksZ = 0;
+        return;
+    }
+
+    volumeItem.bricksX = (width + volumeBrickSize - 1) / volumeBrickSize;
+    volumeItem.bricksY = (height + volumeBrickSize - 1) / volumeBrickSize;
+    volumeItem.bricksZ = (depth + volumeBrickSize - 1) / volumeBrickSize;
+    const qsizetype brickCount = qsizetype(volumeItem.bricksX) * volumeItem.bricksY
+                                 * volumeItem.bricksZ;
+
+    volumeItem.brickRanges.resize(brickCount * 2);
+    scanVolumeBricks(volume,
+                     volumeItem.brickRanges.data(),
+                     volumeItem.bricksX,
+                     volumeItem.bricksY,
+                     0,
+                     volumeItem.bricksX,
+                     0,
+                     volumeItem.bricksY,
+                     0,
+                     volumeItem.bricksZ);
+}
+
+void QQuickGraphsItem::updateVolumeBrickBox(QCustom3DVolume *volume,
+                                            Volume &volumeItem,
+                                            const QCustomVolumeTextureBox &box)
+{
+    // Sub texture updates keep the dimensions, so the brick grid stays valid
+    const int brickCounts[3] = {volumeItem.bricksX, volumeItem.bricksY, volumeItem.bricksZ};
+    int from[3];
+    int to[3];
+    for (int i = 0; i < 3; ++i) {
+        from[i] = qMax(0, box.from[i] / volumeBrickSize);
+        to[i] = qMin(brickCounts[i], (box.to[i] + volumeBrickSize - 1) / volumeBrickSize);
+        if (from[i] >= to[i])
+            return;
+    }
+    scanVolumeBricks(volume,
+                     volumeItem.brickRanges.data(),
+                     brickCounts[0],
+                     brickCounts[1],
+                     from[0],
+                     to[0],
+                     from[1],
+                     to[1],
+                     from[2],
+                     to[2]);
+    volumeItem.updateOccupancy = true;
+}
+
+void QQuickGraphsItem::updateVolumeOccupancy(QCustom3DVolume *volume, Volume &volumeItem)
+{
+    const QList<quint16> &ranges = volumeItem.brickRanges;
+    const qsizetype brickCount = ranges.size() / 2;
+    auto occupancyTextureData = volumeItem.occupancyTextureData;
+
+    volumeItem.updateOccupancy = false;
+    if (!brickCount) {
+        occupancyTextureData->setSize(QSize(1, 1));
+        occupancyTextureData->setDepth(1);
+        occupancyTextureData->setTextureData(QByteArray(1, char(0xff)));
+        return;
+    }
+
+    QByteArray occupancy(brickCount, 0);
+    const QImage::Format format = volume->textureFormat();
+    const QList<QRgb> &colorTable = volume->colorTable();
+    const qsizetype tableSize = colorTable.size();
+    if (format == QImage::Format_ARGB32) {
+        for (qsizetype i = 0; i < brickCount; ++i) {
+            if (ranges.at(i * 2 + 1) > 0)
+                occupancy[i] = char(0xff);
+        }
+    } else if (!tableSize) {
+        occupancy.fill(char(0xff));
+    } else {
+        // Count of visible colors before each table index, so that any range of the table
+        // can be tested for visible colors in constant time
+        QList<qsizetype> visibleColors(tableSize + 1, 0);
+        for (qsizetype i = 0; i < tableSize; ++i)
+            visibleColors[i + 1] = visibleColors.at(i) + (qAlpha(colorTable.at(i)) > 0 ? 1 : 0);
+
+        // Mirrors the color table lookup in the volume shaders
+        const float maxValue = (format == QImage::Format_Grayscale16) ? 65535.0f : 255.0f;
+        const QVector2D window = volumeItem.valueWindow;
+        auto tableIndex = [&](quint16 value) {
+            const float position = qBound(0.0f,
+                                          (float(value) / maxValue - window.x()) * window.y(),
+                                          1.0f);
+            return qBound(qsizetype(0), qsizetype(position * float(tableSize)), tableSize - 1);
+        };
+
+        for (qsizetype i = 0; i < brickCount; ++i) {
+            // Widen the range by one entry to stay conservative about rounding on the GPU
+            const qsizetype first = qMax(qsizetype(0), tableIndex(ranges.at(i * 2)) - 1);
+            const qsizetype last = qMin(tableSize - 1, tableIndex(ranges.at(i * 2 + 1)) + 1);
+            if (visibleColors.at(last + 1) > visibleColors.at(first))
+                occupancy[i] = char(0xff);
+        }
+    }
+
+    occupancyTextureData->setSize(QSize(volumeItem.bricksX, volumeItem.bricksY));
+    occupancyTextureData->setDepth(volumeItem.bricksZ);
+    occupancyTextureData->setTextureData(occupancy);
+}
+
+void QQuickGraphsItem::setVolumeBrickProperties(QObject *material,
+                                                QCustom3DVolume *volume,
+                                                const Volume &volumeItem)
+{
+    const QVector3D textureSize(float(volume->textureWidth()),
+                                float(volume->textureHeight()),
+                                float(volume->textureDepth()));
+    const QVector3D brickCounts(float(qMax(volumeItem.bricksX, 1)),
+                                float(qMax(volumeItem.bricksY, 1)),
+                                float(qMax(volumeItem.bricksZ, 1)));
+    material->setProperty("brickDimensions", QVector3D(float(volumeBrickSize) / textureSize.x(),
+                                                       float(volumeBrickSize) / textureSize.y(),
+                                                       float(volumeBrickSize) / textureSize.z()));
+    material->setProperty("occupancyScale", textureSize / (float(volumeBrickSize) * brickCounts));
 }
 
 QQuick3DModel *QQuickGraphsItem::createSliceFrame(Volume &volumeItem)
@@ -4482,6 +4736,13 @@ void QQuickGraphsItem::updateCustomVolumes()
                 createVolumeMaterial(volume, volumeItem);
             }
 
+            // The color table sampler is only bound when the material is created
+            const bool useColorTable = volume->textureFormat() != QImage::Format_ARGB32;
+            if (useColorTable && !volumeItem.colorTexture) {
+                materialsRef.clear();
+                createVolumeMaterial(volume, volumeItem);
+            }
+
             QVector3D sliceIndices(
                 (float(volume->sliceIndexX()) + 0.5f) / float(volume->textureWidth()) * 2.0 - 1.0,
                 (float(volume->sliceIndexY()) + 0.5f) / float(volume->textureHeight()) * 2.0 - 1.0,
@@ -4618,18 +4879,42 @@ void QQuickGraphsItem::updateCustomVolumes()
                               + volume->textureDepth();
             material->setProperty("sampleCount", sampleCount);
 
-            int color8Bit = (volume->textureFormat() == QImage::Format_Indexed8) ? 1 : 0;
-            material->setProperty("color8Bit", color8Bit);
+            material->setProperty("color8Bit", useColorTable ? 1 : 0);
 
-            if (volumeItem.updateTextureData) {
-                auto textureData = volumeItem.textureData;
-                textureData->setSize(QSize(volume->textureWidth(), volume->textureHeight()));
+            // Only 16-bit scalar data is windowed, indexed data maps directly to the table
+            QVector2D valueWindow(0.0f, 1.0f);
+            if (volume->textureFormat() == QImage::Format_Grayscale16) {
+                valueWindow = QVector2D(volume->windowLevel() - volume->windowWidth() * 0.5f,
+                                        1.0f / volume->windowWidth());
+            }
+            material->setProperty("valueWindow", valueWindow);
+            if (volumeItem.valueWindow != valueWindow) {
+                volumeItem.valueWindow = valueWindow;
+                volumeItem.updateOccupancy = true;
+            }
+
+            auto textureData = volumeItem.textureData;
+            const QSize textureSize(volume->textureWidth(), volume->textureHeight());
+            const auto textureFormat = volumeTextureFormat(volume->textureFormat());
+            // Dimension and format changes need the data to be uploaded again, even when
+            // the data array itself did not change
+            if (textureData->size() != textureSize || textureData->depth() != volume->textureDepth()
+                || textureData->format() != textureFormat) {
+                textureData->setSize(textureSize);
                 textureData->setDepth(volume->textureDepth());
+                textureData->setFormat(textureFormat);
+                volumeItem.updateTextureData = true;
+                volumeItem.rescanBricks = true;
+            }
 
-                if (color8Bit)
-                    textureData->setFormat(QQuick3DTextureData::R8);
-                else
-                    textureData->setFormat(QQuick3DTextureData::RGBA8);
+            if (volumeItem.updateTextureData) {
+                // Sub texture updates only touch the bricks in the box written since the
+                // last update, anything else may have replaced the whole array
+                bool wholeTexture = false;
+                const QCustomVolumeTextureBox dirtyBox = volume->d_func()->takeDirtyTextureBox(
+                    &wholeTexture);
+                if (wholeTexture)
+                    volumeItem.rescanBricks = true;
 
                 textureData->setTextureData(
                     QByteArray::fromRawData(reinterpret_cast<const char *>(
@@ -4641,6 +4926,14 @@ void QQuickGraphsItem::updateCustomVolumes()
                                                 1.0f / float(volume->textureHeight()),
                                                 1.0f / float(volume->textureDepth())));
 
+                if (volumeItem.rescanBricks || volumeItem.brickRanges.isEmpty())
+                    updateVolumeBrickRanges(volume, volumeItem);
+                else
+                    updateVolumeBrickBox(volume, volumeItem, dirtyBox);
+                volumeItem.rescanBricks = false;
+                if (!volumeItem.drawSlices)
+                    setVolumeBrickProperties(material, volume, volumeItem);
+
                 volumeItem.updateTextureData = false;
             }
 
@@ -4657,8 +4950,14 @@ void QQuickGraphsItem::updateCustomVolumes()
                         QByteArray::fromRawData(reinterpret_cast<const char *>(&shifted),
                                                 sizeof(shifted)));
                 }
+                colorTextureData->setSize(QSize(int(colorTable.size()), 1));
                 colorTextureData->setTextureData(colorTableBytes);
+                volumeItem.updateColorTextureData = false;
+                volumeItem.updateOccupancy = true;
             }
+
+            if (volumeItem.updateOccupancy)
+                updateVolumeOccupancy(volume, volumeItem);
         }
         ++itemIterator;
     }
@@ -31,6 +31,7 @@ class QAbstract3DSeries;
 class QCustom3DItem;
 class QCustom3DVolume;
 class QCustom3DLabel;
+struct QCustomVolumeTextureBox;
 class QGraphsInputHandler;
 class QGraphsTheme;
 class QQuick3DCustomMaterial;
@@ -328,6 +329,20 @@ public:
     bool isSlicingActive() const;
     void setSlicingActive(bool isSlicing);
 
+    // Number of times synchData() has run, and how many times it updated each subsystem
+    struct SynchUpdateCounts
+    {
+        qint64 synchs = 0;
+        qint64 grid = 0;
+        qint64 labels = 0;
+        qint64 customData = 0;
+        qint64 customVolumes = 0;
+        qint64 graph = 0;
+    };
+
+    const SynchUpdateCounts &synchUpdateCounts() const { return m_synchCounts; }
+    void resetSynchUpdateCounts() { m_synchCounts = {}; }
+
     bool isCustomDataDirty() const { return m_isCustomDataDirty; }
     void setCustomDataDirty(bool dirty) { m_isCustomDataDirty = dirty; }
     bool isCustomItemDirty() const { return m_isCustomItemDirty; }
@@ -730,8 +745,18 @@ protected:
         QQuick3DTextureData *textureData = nullptr;
         QQuick3DTexture *colorTexture = nullptr;
         QQuick3DTextureData *colorTextureData = nullptr;
+        QQuick3DTexture *occupancyTexture = nullptr;
+        QQuick3DTextureData *occupancyTextureData = nullptr;
+        // Smallest and largest value of each brick, interleaved
+        QList<quint16> brickRanges;
+        int bricksX = 0;
+        int bricksY = 0;
+        int bricksZ = 0;
+        bool rescanBricks = false;
+        QVector2D valueWindow = QVector2D(0.0f, 1.0f);
         bool updateTextureData = false;
         bool updateColorTextureData = false;
+        bool updateOccupancy = false;
         bool useHighDefShader = false;
         bool drawSlices = false;
         bool drawSliceFrames = false;
@@ -880,6 +905,9 @@ private:
     bool m_hasVerticalSegmentLine = true;
 
     QVector3D m_scaleWithBackground = QVector3D(1.0f, 1.0f, 1.0f);
+    // Scene scale that the grid and the labels were last built for
+    QVector3D m_gridSceneScale;
+    SynchUpdateCounts m_synchCounts;
     QVector3D m_backgroundScaleMargin = QVector3D(0.0f, 0.0f, 0.0f);
 
     QVector3D m_rot = QVector3D(1.0f, 1.0f, 1.0f);
@@ -927,10 +955,19 @@ private:
     QVector3D graphPosToAbsolute(QVector3D position);
 
     void createVolumeMaterial(QCustom3DVolume *volume, Volume &volumeItem);
+    void updateVolumeBrickRanges(QCustom3DVolume *volume, Volume &volumeItem);
+    void updateVolumeBrickBox(QCustom3DVolume *volume,
+                              Volume &volumeItem,
+                              const QCustomVolumeTextureBox &box);
+    void updateVolumeOccupancy(QCustom3DVolume *volume, Volume &volumeItem);
+    void setVolumeBrickProperties(QObject *material,
+                                  QCustom3DVolume *volume,
+                                  const Volume &volumeItem);
     QQuick3DModel *createSliceFrame(Volume &volumeItem);
     void updateSliceFrameMaterials(QCustom3DVolume *volume, Volume &volumeItem);
     void updateSubViews();
     void updateCustomVolumes();
+    void updateGridAndLabels();
 
     bool m_sliceUseOrthoProjection = false;
 
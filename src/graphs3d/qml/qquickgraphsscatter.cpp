@@ -288,52 +288,10 @@ void QQuickGraphsScatter::updateScatterGraphItemPositions(ScatterModel *graphMod
     } else if (optimizationHint() == QtGraphs3D::OptimizationHint::Default) {
         qsizetype count = dataProxy->itemCount();
         QList<DataItemHolder> positions;
+        positions.reserve(count);
 
-        for (int i = 0; i < count; i++) {
-            const QScatterDataItem &item = dataProxy->itemAt(i);
-            QVector3D dotPos = item.position();
-
-            if (isDotPositionInAxisRange(dotPos)) {
-                float dotPosX = xReversed ? 1.0f - valueAxisX->positionAt(dotPos.x())
-                                          : valueAxisX->positionAt(dotPos.x());
-                float dotPosY = yReversed ? 1.0f - valueAxisY->positionAt(dotPos.y())
-                                          : valueAxisY->positionAt(dotPos.y());
-                float dotPosZ = zReversed ? 1.0f - valueAxisZ->positionAt(dotPos.z())
-                                          : valueAxisZ->positionAt(dotPos.z());
-
-                float posX = dotPosX * scale().x() + translate().x();
-                float posY = dotPosY * scale().y() + translate().y();
-                float posZ = dotPosZ * scale().z() + translate().z();
-
-                QQuaternion totalRotation;
-
-                if (graphModel->series->mesh() != QAbstract3DSeries::Mesh::Point)
-                    totalRotation = item.rotation() * meshRotation;
-                else
-                    totalRotation = cameraTarget()->rotation();
-
-                DataItemHolder dih;
-                if (isPolar()) {
-                    float x;
-                    float z;
-                    calculatePolarXZ(axisX()->positionAt(dotPos.x()),
-                                     axisZ()->positionAt(dotPos.z()),
-                                     x,
-                                     z);
-                    dih.position = {x, posY, z};
-                } else {
-                    dih.position = {posX, posY, posZ};
-                }
-                dih.rotation = totalRotation;
-                dih.scale = {itemSize, itemSize, itemSize};
-
-                positions.push_back(dih);
-            } else {
-                DataItemHolder dih;
-                dih.hide = true;
-                positions.push_back(dih);
-            }
-        }
+        for (int i = 0; i < count; i++)
+            positions.push_back(dataItemHolder(graphModel, dataProxy->itemAt(i), itemSize));
         graphModel->instancing->setDataArray(positions);
 
         if (selectedItemInSeries(graphModel->series)) {
@@ -355,6 +313,85 @@ void QQuickGraphsScatter::updateScatterGraphItemPositions(ScatterModel *graphMod
     }
 }
 
+DataItemHolder QQuickGraphsScatter::dataItemHolder(ScatterModel *graphModel,
+                                                   const QScatterDataItem &item,
+                                                   float itemSize)
+{
+    DataItemHolder dih;
+    QVector3D dotPos = item.position();
+    if (!isDotPositionInAxisRange(dotPos)) {
+        dih.hide = true;
+        return dih;
+    }
+
+    auto valueAxisX = static_cast<QValue3DAxis *>(axisX());
+    auto valueAxisY = static_cast<QValue3DAxis *>(axisY());
+    auto valueAxisZ = static_cast<QValue3DAxis *>(axisZ());
+
+    float dotPosX = valueAxisX->reversed() ? 1.0f - valueAxisX->positionAt(dotPos.x())
+                                           : valueAxisX->positionAt(dotPos.x());
+    float dotPosY = valueAxisY->reversed() ? 1.0f - valueAxisY->positionAt(dotPos.y())
+                                           : valueAxisY->positionAt(dotPos.y());
+    float dotPosZ = valueAxisZ->reversed() ? 1.0f - valueAxisZ->positionAt(dotPos.z())
+                                           : valueAxisZ->positionAt(dotPos.z());
+
+    float posX = dotPosX * scale().x() + translate().x();
+    float posY = dotPosY * scale().y() + translate().y();
+    float posZ = dotPosZ * scale().z() + translate().z();
+
+    QQuaternion totalRotation;
+
+    if (graphModel->series->mesh() != QAbstract3DSeries::Mesh::Point)
+        totalRotation = item.rotation() * graphModel->series->meshRotation();
+    else
+        totalRotation = cameraTarget()->rotation();
+
+    if (isPolar()) {
+        float x;
+        float z;
+        calculatePolarXZ(axisX()->positionAt(dotPos.x()), axisZ()->positionAt(dotPos.z()), x, z);
+        dih.position = {x, posY, z};
+    } else {
+        dih.position = {posX, posY, posZ};
+    }
+    dih.rotation = totalRotation;
+    dih.scale = {itemSize, itemSize, itemSize};
+    return dih;
+}
+
+// Updates the instance table entries of the items changed with QScatterDataProxy::setItem()
+// and setItems(), when nothing else requires all positions to be updated
+void QQuickGraphsScatter::updateChangedScatterGraphItems()
+{
+    for (const ChangeItem &changeItem : std::as_const(m_changedItems)) {
+        ScatterModel *graphModel = findGraphModel(changeItem.series);
+        if (!graphModel || !graphModel->series->isVisible())
+            continue;
+
+        if (optimizationHint() == QtGraphs3D::OptimizationHint::Legacy
+            || !graphModel->instancing
+            || changeItem.index >= graphModel->instancing->dataArray().size()) {
+            updateScatterGraphItemPositions(graphModel);
+            continue;
+        }
+
+        float itemSize = graphModel->series->itemSize() / m_itemScaler;
+        if (itemSize == 0.0f)
+            itemSize = m_pointScale;
+
+        const QScatterDataItem &item = graphModel->series->dataProxy()->itemAt(changeItem.index);
+        DataItemHolder dih = dataItemHolder(graphModel, item, itemSize);
+        // Keep the selected item hidden under the selection indicator
+        if (selectedItemInSeries(graphModel->series) && m_selectedItem == changeItem.index
+            && !dih.hide) {
+            dih.hide = true;
+            if (graphModel->selectionIndicator)
+                graphModel->selectionIndicator->setPosition(dih.position);
+        }
+        graphModel->instancing->setDataItem(changeItem.index, dih);
+    }
+}
+
 void QQuickGraphsScatter::updateScatterGraphItemVisuals(ScatterModel *graphModel)
 {
     bool useGradient = graphModel->series->d_func()->isUsingGradient();
@@ -546,7 +583,6 @@ void QQuickGraphsScatter::updateScatterGraphItemVisuals(ScatterModel *graphModel
             graphModel->selectionIndicator->setVisible(true);
             graphModel->instancing->hideDataItem(m_selectedItem);
             updateItemLabel(graphModel->selectionIndicator->position());
-            graphModel->instancing->markDataDirty();
         } else if ((m_selectedItem == -1 || m_selectedItemSeries != graphModel->series)
                    && graphModel->selectionIndicator) {
             graphModel->selectionIndicator->setVisible(false);
@@ -1155,32 +1191,22 @@ void QQuickGraphsScatter::handleItemsAdded(qsizetype startIndex, qsizetype count
 void QQuickGraphsScatter::handleItemsChanged(qsizetype startIndex, qsizetype count)
 {
     QScatter3DSeries *series = static_cast<QScatterDataProxy *>(sender())->series();
-    qsizetype oldChangeCount = m_changedItems.size();
-    if (!oldChangeCount)
-        m_changedItems.reserve(count);
-
-    for (int i = 0; i < count; i++) {
-        bool newItem = true;
-        qsizetype candidate = startIndex + i;
-        for (qsizetype j = 0; j < oldChangeCount; j++) {
-            const ChangeItem &oldChangeItem = m_changedItems.at(j);
-            if (oldChangeItem.index == candidate && series == oldChangeItem.series) {
-                newItem = false;
-                break;
-            }
-        }
-        if (newItem) {
-            ChangeItem newChangeItem = {series, candidate};
-            m_changedItems.append(newChangeItem);
-            if (series == m_selectedItemSeries && m_selectedItem == candidate)
-                series->d_func()->markItemLabelDirty();
-        }
+    // Duplicates are harmless, updating the same item twice gives the same result
+    m_changedItems.reserve(m_changedItems.size() + count);
+    for (qsizetype i = 0; i < count; i++)
+        m_changedItems.append({series, startIndex + i});
+
+    if (series == m_selectedItemSeries && m_selectedItem >= startIndex
+        && m_selectedItem < startIndex + count) {
+        series->d_func()->markItemLabelDirty();
     }
 
     if (count) {
         m_changeTracker.itemChanged = true;
         if (series->isVisible())
             adjustAxisRanges();
+        if (!m_changedSeriesList.contains(series))
+            m_changedSeriesList.append(series);
         emitNeedRender();
     }
 }
@@ -1848,6 +1874,14 @@ void QQuickGraphsScatter::updateGraph()
         m_optimizationChanged = false;
     }
 
+    // Changed items only need their own instances updated, unless all of them are updated
+    if (hasItemChanged()) {
+        if (!isDataDirty() && !isSeriesVisualsDirty())
+            updateChangedScatterGraphItems();
+        m_changedItems.clear();
+        setItemChanged(false);
+    }
+
     for (auto graphModel : std::as_const(m_scatterGraphs)) {
         bool seriesVisible = graphModel->series->isVisible();
         if (isDataDirty()) {
@@ -251,6 +251,10 @@ private:
 
     void generatePointsForScatterModel(ScatterModel *series);
     void updateScatterGraphItemPositions(ScatterModel *graphModel);
+    void updateChangedScatterGraphItems();
+    DataItemHolder dataItemHolder(ScatterModel *graphModel,
+                                  const QScatterDataItem &item,
+                                  float itemSize);
     void updateScatterGraphItemVisuals(ScatterModel *graphModel);
 
     QQuick3DModel *selected() const;
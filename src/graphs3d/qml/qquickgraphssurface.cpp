@@ -1317,17 +1317,46 @@ QRect QQuickGraphsSurface::calculateSampleSpace(SurfaceModel *model)
     return sampleSpace;
 }
 
+// Averages the finite heights of the items in a block of the array, or returns fallback
+// if there are none.
+inline static float averageHeight(const QSurfaceDataArray &array,
+                                  int rowFirst,
+                                  int rowEnd,
+                                  int columnFirst,
+                                  int columnEnd,
+                                  float fallback)
+{
+    double sum = 0.0;
+    qsizetype count = 0;
+    for (int i = rowFirst; i < rowEnd; i++) {
+        const QSurfaceDataRow &row = array.at(i);
+        for (int j = columnFirst; j < columnEnd; j++) {
+            const float height = row.at(j).y();
+            if (qIsFinite(height)) {
+                sum += height;
+                count++;
+            }
+        }
+    }
+    return count ? float(sum / count) : fallback;
+}
+
 void QQuickGraphsSurface::updateModel(SurfaceModel *model)
 {
     const QSurfaceDataArray &array = model->series->dataArray();
 
     if (!array.isEmpty()) {
-        qsizetype rowCount = array.size();
-        qsizetype columnCount = array.at(0).size();
-
+        const qsizetype dataRowCount = array.size();
+        const qsizetype dataColumnCount = array.at(0).size();
+
+        // The mesh and the height map are capped at the maximum texture size.
+        // Larger grids are sampled with a stride chosen from the visible range,
+        // so the whole range is drawn and zooming in brings back the detail.
+        // Each sample gets the average height of the items around it, so the
+        // rows and columns between the samples are not dropped.
         const qsizetype maxSize = 4096; // maximum texture size
-        columnCount = qMin(maxSize, columnCount);
-        rowCount = qMin(maxSize, rowCount);
+        qsizetype columnCount = qMin(maxSize, dataColumnCount);
+        qsizetype rowCount = qMin(maxSize, dataRowCount);
 
         if (model->rowCount != rowCount) {
             model->rowCount = rowCount;
@@ -1349,9 +1378,20 @@ void QQuickGraphsSurface::updateModel(SurfaceModel *model)
         int rowLimit = sampleSpace.bottom() + 1;
         int columnLimit = sampleSpace.right() + 1;
 
+        auto sampleStepFor = [maxSize](int extent) {
+            return qMax(1, int((extent + maxSize - 3) / (maxSize - 1)));
+        };
+        auto sampledCountFor = [](int extent, int step) {
+            return extent < 1 ? extent : (extent + step - 2) / step + 1;
+        };
+        const QPoint sampleStep(sampleStepFor(sampleSpace.width()),
+                                sampleStepFor(sampleSpace.height()));
+        const QSize sampledSize(sampledCountFor(sampleSpace.width(), sampleStep.x()),
+                                sampledCountFor(sampleSpace.height(), sampleStep.y()));
+
         QPoint selC = model->selectedVertex.coord;
-        selC.setX(qMin(selC.x(), int(columnCount) - 1));
-        selC.setY(qMin(selC.y(), int(rowCount) - 1));
+        selC.setX(qMin(selC.x(), int(dataColumnCount) - 1));
+        selC.setY(qMin(selC.y(), int(dataRowCount) - 1));
         QVector3D selP = array.at(selC.y()).at(selC.x()).position();
 
         bool pickOutOfRange = false;
@@ -1368,18 +1408,17 @@ void QQuickGraphsSurface::updateModel(SurfaceModel *model)
                 m_selectionDirty = true;
             }
         }
-        qsizetype totalSize = rowCount * columnCount * 2;
+        qsizetype totalSize = qsizetype(sampledSize.width()) * sampledSize.height();
         float uvX = 1.0f / float(columnCount - 1);
         float uvY = 1.0f / float(rowCount - 1);
+        float dataUvX = 1.0f / float(dataColumnCount - 1);
+        float dataUvY = 1.0f / float(dataRowCount - 1);
 
         bool flatShading = model->series->shading() == QSurface3DSeries::Shading::Flat;
 
         QVector3D boundsMin = model->boundsMin;
         QVector3D boundsMax = model->boundsMax;
 
-        QVector<QVector4D> heights;
-        heights.reserve(totalSize);
-
         QQmlListReference materialRef(model->model, "materials");
         auto material = materialRef.at(0);
         QVariant heightInputAsVariant = material->property("height");
@@ -1395,14 +1434,14 @@ void QQuickGraphsSurface::updateModel(SurfaceModel *model)
             heightMap->setMinFilter(QQuick3DTexture::Nearest);
             heightMap->setMagFilter(QQuick3DTexture::Nearest);
             heightMapData = new QQuick3DTextureData();
-            heightMapData->setSize(QSize(sampleSpace.width(), sampleSpace.height()));
+            heightMapData->setSize(sampledSize);
             heightMapData->setFormat(QQuick3DTextureData::RGBA32F);
             heightMapData->setParent(heightMap);
             heightMapData->setParentItem(heightMap);
         } else {
             heightMapData = heightMap->textureData();
             if (dimensionsChanged)
-                heightMapData->setSize(QSize(sampleSpace.width(), sampleSpace.height()));
+                heightMapData->setSize(sampledSize);
         }
         if (heightMapData->size().width() < 1 || heightMapData->size().height() < 1) {
             heightMapData->setTextureData(QByteArray());
@@ -1412,13 +1451,15 @@ void QQuickGraphsSurface::updateModel(SurfaceModel *model)
             return;
         }
 
-        material->setProperty("xDiff", 1.0f / float(sampleSpace.width() - 1));
-        material->setProperty("yDiff", 1.0f / float(sampleSpace.height() - 1));
+        material->setProperty("xDiff", 1.0f / float(sampledSize.width() - 1));
+        material->setProperty("yDiff", 1.0f / float(sampledSize.height() - 1));
         material->setProperty("flatShading", flatShading);
         material->setProperty("graphHeight", scaleWithBackground().y());
         material->setProperty("uvOffset", QVector2D(columnStart, rowStart));
-        material->setProperty("size", QVector2D(sampleSpace.width(), sampleSpace.height()));
+        material->setProperty("size", QVector2D(sampledSize.width(), sampledSize.height()));
         material->setProperty("vertCount", QVector2D(columnCount, rowCount));
+        material->setProperty("sampleStep", QVector2D(sampleStep));
+        material->setProperty("dataSize", QVector2D(dataColumnCount, dataRowCount));
         material->setProperty("flipU", !model->ascendingX);
         material->setProperty("flipV", !model->ascendingZ);
         for (int i = 0; i < m_seriesList.size(); i++) {
@@ -1429,14 +1470,30 @@ void QQuickGraphsSurface::updateModel(SurfaceModel *model)
         model->vertices.clear();
         model->vertices.reserve(totalSize);
 
-        for (int i = rowStart; i < rowLimit; i++) {
+        const bool filterHeights = sampleStep != QPoint(1, 1);
+        for (int sampledRow = 0; sampledRow < sampledSize.height(); sampledRow++) {
+            const int i = qMin(rowStart + sampledRow * sampleStep.y(), rowLimit - 1);
             const QSurfaceDataRow &row = array.at(i);
-            for (int j = columnStart; j < columnLimit; j++) {
-                QVector3D pos = getNormalizedVertex(row.at(j), isPolar(), false);
-                heights.push_back(QVector4D(pos, .0f));
+            // The blocks of consecutive samples tile the sample space
+            const int blockTop = i - sampleStep.y() / 2;
+            const int rowFirst = qMax(rowStart, blockTop);
+            const int rowEnd = qMin(rowLimit, blockTop + sampleStep.y());
+            for (int sampledColumn = 0; sampledColumn < sampledSize.width(); sampledColumn++) {
+                const int j = qMin(columnStart + sampledColumn * sampleStep.x(), columnLimit - 1);
+                QSurfaceDataItem item = row.at(j);
+                if (filterHeights) {
+                    const int blockLeft = j - sampleStep.x() / 2;
+                    item.setY(averageHeight(array,
+                                            rowFirst,
+                                            rowEnd,
+                                            qMax(columnStart, blockLeft),
+                                            qMin(columnLimit, blockLeft + sampleStep.x()),
+                                            item.y()));
+                }
+                QVector3D pos = getNormalizedVertex(item, isPolar(), false);
                 SurfaceVertex vertex;
                 vertex.position = pos;
-                vertex.uv = QVector2D(j * uvX, i * uvY);
+                vertex.uv = QVector2D(j * dataUvX, i * dataUvY);
                 vertex.coord = QPoint(j, i);
                 model->vertices.push_back(vertex);
                 if (!qIsNaN(pos.y()) && !qIsInf(pos.y())) {
@@ -1460,12 +1517,47 @@ void QQuickGraphsSurface::updateModel(SurfaceModel *model)
         model->boundsMin = boundsMin;
         model->boundsMax = boundsMax;
 
-        QByteArray heightData = QByteArray(reinterpret_cast<char *>(heights.data()),
-                                           heights.size() * sizeof(QVector4D));
+        // On a regular grid x depends only on the column and z only on the row,
+        // so the height map stores just y and surface.vert looks x and z up from
+        // two one-dimensional textures. Anything else, like polar graphs, still
+        // uploads full positions.
+        const int sampledColumns = sampledSize.width();
+        const int sampledRows = sampledSize.height();
+        QVector<float> xCoords(sampledColumns);
+        QVector<float> zCoords(sampledRows);
+        for (int i = 0; i < sampledColumns; i++)
+            xCoords[i] = model->vertices.at(i).position.x();
+        for (int i = 0; i < sampledRows; i++)
+            zCoords[i] = model->vertices.at(i * sampledColumns).position.z();
+        bool heightOnly = !isPolar();
+        for (qsizetype i = 0; heightOnly && i < model->vertices.size(); i++) {
+            const QVector3D &pos = model->vertices.at(i).position;
+            heightOnly = pos.x() == xCoords.at(i % sampledColumns)
+                         && pos.z() == zCoords.at(i / sampledColumns);
+        }
+
+        QByteArray heightData;
+        if (heightOnly) {
+            heightData.resize(model->vertices.size() * sizeof(float));
+            float *heights = reinterpret_cast<float *>(heightData.data());
+            for (const SurfaceVertex &vertex : std::as_const(model->vertices))
+                *heights++ = vertex.position.y();
+            updateCoordinateTexture(model->xCoordTexture, xCoords);
+            updateCoordinateTexture(model->zCoordTexture, zCoords);
+        } else {
+            heightData.resize(model->vertices.size() * sizeof(QVector4D));
+            QVector4D *heights = reinterpret_cast<QVector4D *>(heightData.data());
+            for (const SurfaceVertex &vertex : std::as_const(model->vertices))
+                *heights++ = QVector4D(vertex.position, .0f);
+        }
+        heightMapData->setFormat(heightOnly ? QQuick3DTextureData::R32F
+                                            : QQuick3DTextureData::RGBA32F);
         heightMapData->setTextureData(heightData);
         heightMap->setTextureData(heightMapData);
         heightInput->setTexture(heightMap);
         model->heightTexture = heightMap;
+        model->heightOnly = heightOnly;
+        setCoordinateTextures(material, model);
 
         if (m_isIndexDirty) {
             QVector<SurfaceVertex> vertices;
@@ -1512,9 +1604,10 @@ void QQuickGraphsSurface::updateModel(SurfaceModel *model)
         QQuick3DShaderUtilsTextureInput *gridHeightInput
             = gridHeightInputAsVariant.value<QQuick3DShaderUtilsTextureInput *>();
         gridHeightInput->setTexture(heightMap);
+        setCoordinateTextures(gridMaterial, model);
         QColor gridColor = model->series->wireframeColor();
         gridMaterial->setProperty("gridColor", gridColor);
-        gridMaterial->setProperty("range", QVector2D(sampleSpace.width(), sampleSpace.height()));
+        gridMaterial->setProperty("range", QVector2D(sampledSize.width(), sampledSize.height()));
         gridMaterial->setProperty("vertices", QVector2D(columnCount, rowCount));
         gridMaterial->setProperty("graphHeight", scaleWithBackground().y());
 
@@ -1524,6 +1617,41 @@ void QQuickGraphsSurface::updateModel(SurfaceModel *model)
     updateSelectedPoint();
 }
 
+void QQuickGraphsSurface::updateCoordinateTexture(QQuick3DTexture *&texture,
+                                                  const QVector<float> &coords)
+{
+    QQuick3DTextureData *textureData = nullptr;
+    if (!texture) {
+        texture = new QQuick3DTexture();
+        texture->setParent(this);
+        texture->setHorizontalTiling(QQuick3DTexture::ClampToEdge);
+        texture->setVerticalTiling(QQuick3DTexture::ClampToEdge);
+        texture->setMinFilter(QQuick3DTexture::Nearest);
+        texture->setMagFilter(QQuick3DTexture::Nearest);
+        textureData = new QQuick3DTextureData();
+        textureData->setFormat(QQuick3DTextureData::R32F);
+        textureData->setParent(texture);
+        textureData->setParentItem(texture);
+    } else {
+        textureData = texture->textureData();
+    }
+    textureData->setSize(QSize(coords.size(), 1));
+    textureData->setTextureData(QByteArray(reinterpret_cast<const char *>(coords.constData()),
+                                           coords.size() * sizeof(float)));
+    texture->setTextureData(textureData);
+}
+
+void QQuickGraphsSurface::setCoordinateTextures(QObject *material, SurfaceModel *model)
+{
+    material->setProperty("heightOnly", model->heightOnly);
+    if (!model->heightOnly)
+        return;
+    material->property("xCoords").value<QQuick3DShaderUtilsTextureInput *>()->setTexture(
+        model->xCoordTexture);
+    material->property("zCoords").value<QQuick3DShaderUtilsTextureInput *>()->setTexture(
+        model->zCoordTexture);
+}
+
 void QQuickGraphsSurface::updateProxyModel(SurfaceModel *model)
 {
     if (!model->proxyModel)
@@ -1736,6 +1864,7 @@ void QQuickGraphsSurface::updateMaterial(SurfaceModel *model)
         QQuick3DShaderUtilsTextureInput *heightInput
             = heightInputAsVariant.value<QQuick3DShaderUtilsTextureInput *>();
         heightInput->setTexture(model->heightTexture);
+        setCoordinateTextures(material, model);
         material->setParent(model->model);
         material->setParentItem(model->model);
         material->setCullMode(QQuick3DMaterial::NoCulling);
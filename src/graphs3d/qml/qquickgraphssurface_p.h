@@ -206,6 +206,8 @@ private:
         QSurface3DSeries *series;
         QQuick3DTexture *texture;
         QQuick3DTexture *heightTexture;
+        QQuick3DTexture *xCoordTexture;
+        QQuick3DTexture *zCoordTexture;
         QQuick3DCustomMaterial *customMaterial;
         qsizetype columnCount;
         qsizetype rowCount;
@@ -216,6 +218,7 @@ private:
         QRect sampleSpace;
         bool ascendingX;
         bool ascendingZ;
+        bool heightOnly = false;
     };
 
     QVector3D getNormalizedVertex(const QSurfaceDataItem &data, bool polar, bool flipXZ);
@@ -228,6 +231,8 @@ private:
     void updateModel(SurfaceModel *model);
     void createProxyModel(SurfaceModel *parentModel);
     void updateProxyModel(SurfaceModel *model);
+    void updateCoordinateTexture(QQuick3DTexture *&texture, const QVector<float> &coords);
+    void setCoordinateTextures(QObject *material, SurfaceModel *model);
     void updateMaterial(SurfaceModel *model);
     void updateSelectedPoint();
     void addModel(QSurface3DSeries *series);
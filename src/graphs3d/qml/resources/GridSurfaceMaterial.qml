@@ -7,6 +7,9 @@ import QtQuick
 CustomMaterial {
     property color gridColor: 'black'
     property TextureInput height: TextureInput {}
+    property TextureInput xCoords: TextureInput {}
+    property TextureInput zCoords: TextureInput {}
+    property bool heightOnly: false
 
     property vector2d vertices
     property vector2d range
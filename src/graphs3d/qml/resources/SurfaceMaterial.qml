@@ -7,6 +7,9 @@ import QtQuick
 CustomMaterial {
     property TextureInput custex: TextureInput {}
     property TextureInput height: TextureInput {}
+    property TextureInput xCoords: TextureInput {}
+    property TextureInput zCoords: TextureInput {}
+    property bool heightOnly: false
     property TextureInput baseColor: TextureInput {}
 
     property real xDiff: 0.0
@@ -15,6 +18,8 @@ CustomMaterial {
     property vector2d uvOffset
     property vector2d size
     property vector2d vertCount
+    property vector2d sampleStep: Qt.vector2d(1, 1)
+    property vector2d dataSize
 
     property real gradientMin
     property real gradientHeight
@@ -10,7 +10,11 @@ CustomMaterial {
     property TextureInput textureSampler: TextureInput {}
     property TextureInput colorSampler: TextureInput {}
     property int color8Bit
+    property vector2d valueWindow: Qt.vector2d(0, 1)
     property vector3d textureDimensions
+    property TextureInput occupancySampler: TextureInput {}
+    property vector3d occupancyScale: Qt.vector3d(1, 1, 1)
+    property vector3d brickDimensions: Qt.vector3d(1, 1, 1)
     property int sampleCount
     property real alphaMultiplier
     property int preserveOpacity
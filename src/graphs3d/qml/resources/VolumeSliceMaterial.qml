@@ -11,6 +11,7 @@ CustomMaterial {
     property TextureInput colorSampler: TextureInput {}
     property vector3d volumeSliceIndices;
     property int color8Bit
+    property vector2d valueWindow: Qt.vector2d(0, 1)
     property vector3d textureDimensions
     property int sampleCount
     property real alphaMultiplier
@@ -22,6 +22,7 @@ private slots:
     void selectDeselectSum();
     void appendInsertRemove();
     void replaceAt();
+    void replaceAll();
 
 private:
     QBarSet *m_set;
@@ -245,5 +246,46 @@ void tst_barset::replaceAt()
     QCOMPARE(spy1.size(), 3);
 }
 
+void tst_barset::replaceAll()
+{
+    QVERIFY(m_set);
+
+    QSignalSpy valuesSpy(m_set, &QBarSet::valuesChanged);
+    QSignalSpy countSpy(m_set, &QBarSet::countChanged);
+    QSignalSpy selectedSpy(m_set, &QBarSet::selectedBarsChanged);
+
+    m_set->append({10, 20, 30});
+    m_set->selectBars({0, 2});
+    countSpy.clear();
+    selectedSpy.clear();
+
+    // Same size keeps the selection
+    m_set->replace(QList<qreal>({11, 21, 31}));
+    QCOMPARE(m_set->realValues(), QList<qreal>({11, 21, 31}));
+    QCOMPARE(m_set->values(), QVariantList({11, 21, 31}));
+    QCOMPARE(valuesSpy.size(), 1);
+    QCOMPARE(countSpy.size(), 0);
+    QCOMPARE(selectedSpy.size(), 0);
+    QVERIFY(m_set->isBarSelected(2));
+
+    // Shrinking drops the selections past the end
+    m_set->replace(QList<qreal>({5, 6}));
+    QCOMPARE(m_set->realValues(), QList<qreal>({5, 6}));
+    QCOMPARE(m_set->count(), 2);
+    QCOMPARE(m_set->sum(), 11);
+    QCOMPARE(valuesSpy.size(), 2);
+    QCOMPARE(countSpy.size(), 1);
+    QCOMPARE(selectedSpy.size(), 1);
+    QCOMPARE(m_set->selectedBars(), QList<qsizetype>({0}));
+
+    // Invalid values are skipped like when appending
+    QTest::ignoreMessage(QtWarningMsg, "Ignored NaN, Inf, or -Inf value.");
+    QTest::ignoreMessage(QtWarningMsg, "Ignored NaN, Inf, or -Inf value.");
+    m_set->replace(QList<qreal>({1, qQNaN(), 2, qInf()}));
+    QCOMPARE(m_set->realValues(), QList<qreal>({1, 2}));
+    QCOMPARE(valuesSpy.size(), 3);
+    QCOMPARE(countSpy.size(), 1);
+}
+
 QTEST_MAIN(tst_barset)
 #include "tst_barset.moc"
@@ -3,7 +3,10 @@
 
 #include <QtGraphs/QLineSeries>
 #include <QtGraphs/QValueAxis>
+#include <QtGraphs/private/qgraphsview_p.h>
 #include <QtQml/QQmlComponent>
+#include <QtQuick/QQuickWindow>
+#include <QtQuickTest/quicktest.h>
 #include <QtTest/QtTest>
 
 class tst_lines : public QObject
@@ -22,6 +25,8 @@ private slots:
     void initializeProperties();
     void invalidProperties();
 
+    void polishChangedSeriesOnly();
+
 private:
     QLineSeries *m_series;
 };
@@ -54,6 +59,7 @@ void tst_lines::initialProperties()
     // Properties from QLineSeries
     QCOMPARE(m_series->width(), 2.0);
     QCOMPARE(m_series->capStyle(), Qt::PenCapStyle::SquareCap);
+    QCOMPARE(m_series->decimationEnabled(), false);
     QCOMPARE(m_series->pointDelegate(), nullptr);
 
     // Properties from QXYSeries
@@ -88,11 +94,13 @@ void tst_lines::initializeProperties()
     QSignalSpy spy9(m_series, &QLineSeries::hoverableChanged);
     QSignalSpy spy10(m_series, &QLineSeries::opacityChanged);
     QSignalSpy spy11(m_series, &QLineSeries::valuesMultiplierChanged);
+    QSignalSpy spy12(m_series, &QLineSeries::decimationEnabledChanged);
 
     auto marker = new QQmlComponent(this);
 
     m_series->setWidth(5.0);
     m_series->setCapStyle(Qt::PenCapStyle::RoundCap);
+    m_series->setDecimationEnabled(true);
     m_series->setPointDelegate(marker);
 
     m_series->setColor("#ff0000");
@@ -108,6 +116,7 @@ void tst_lines::initializeProperties()
 
     QCOMPARE(m_series->width(), 5.0);
     QCOMPARE(m_series->capStyle(), Qt::PenCapStyle::RoundCap);
+    QCOMPARE(m_series->decimationEnabled(), true);
     QCOMPARE(m_series->pointDelegate(), marker);
 
     QCOMPARE(m_series->color(), "#ff0000");
@@ -135,6 +144,7 @@ void tst_lines::initializeProperties()
     QCOMPARE(spy9.size(), 1);
     QCOMPARE(spy10.size(), 1);
     QCOMPARE(spy11.size(), 1);
+    QCOMPARE(spy12.size(), 1);
 }
 
 void tst_lines::invalidProperties()
@@ -151,5 +161,36 @@ void tst_lines::invalidProperties()
     QCOMPARE(m_series->valuesMultiplier(), 0.0);
 }
 
+void tst_lines::polishChangedSeriesOnly()
+{
+    QQuickWindow window;
+    QValueAxis axisX;
+    QValueAxis axisY;
+    QLineSeries other;
+    QGraphsView view;
+    view.setParentItem(window.contentItem());
+    view.setSize(QSizeF(200, 200));
+    view.setAxisX(&axisX);
+    view.setAxisY(&axisY);
+    view.addSeries(m_series);
+    view.addSeries(&other);
+    m_series->append(QList<QPointF>({{0, 1}, {1, 2}}));
+    other.append(QList<QPointF>({{0, 2}, {1, 1}}));
+
+    window.resize(200, 200);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QVERIFY(QQuickTest::qWaitForPolish(&view));
+
+    const qsizetype seriesPolishes = view.seriesPolishCount();
+    const qsizetype axisPolishes = view.axisPolishCount();
+    QVERIFY(seriesPolishes >= 2);
+
+    m_series->append(2, 3);
+    QVERIFY(QQuickTest::qWaitForPolish(&view));
+    QCOMPARE(view.seriesPolishCount(), seriesPolishes + 1);
+    QCOMPARE(view.axisPolishCount(), axisPolishes);
+}
+
 QTEST_MAIN(tst_lines)
 #include "tst_lines.moc"
@@ -3,7 +3,11 @@
 
 #include <QtGraphs/QSplineSeries>
 #include <QtGraphs/QValueAxis>
+#include <QtGraphs/private/qgraphsview_p.h>
 #include <QtQml/QQmlComponent>
+#include <QtQuick/QQuickWindow>
+#include <QtQuickShapes/private/qquickshape_p.h>
+#include <QtQuickTest/quicktest.h>
 #include <QtTest/QtTest>
 
 class tst_splines : public QObject
@@ -22,6 +26,8 @@ private slots:
     void initializeProperties();
     void splineSignals();
     void invalidProperties();
+    void controlPoints();
+    void decimation();
 
 private:
     QSplineSeries *m_series;
@@ -59,6 +65,7 @@ void tst_splines::initialProperties()
     QCOMPARE(m_series->selectedColor(), "#00000000");
     QCOMPARE(m_series->width(), 1.0);
     QCOMPARE(m_series->capStyle(), Qt::PenCapStyle::SquareCap);
+    QCOMPARE(m_series->decimationEnabled(), false);
     QCOMPARE(m_series->pointDelegate(), nullptr);
     QCOMPARE(m_series->isDraggable(), false);
 
@@ -79,6 +86,7 @@ void tst_splines::initializeProperties()
 
     m_series->setWidth(5.0);
     m_series->setCapStyle(Qt::PenCapStyle::RoundCap);
+    m_series->setDecimationEnabled(true);
     m_series->setPointDelegate(marker);
 
     m_series->setColor("#ff0000");
@@ -94,6 +102,7 @@ void tst_splines::initializeProperties()
 
     QCOMPARE(m_series->width(), 5.0);
     QCOMPARE(m_series->capStyle(), Qt::PenCapStyle::RoundCap);
+    QCOMPARE(m_series->decimationEnabled(), true);
     QCOMPARE(m_series->pointDelegate(), marker);
 
     QCOMPARE(m_series->color(), "#ff0000");
@@ -128,9 +137,11 @@ void tst_splines::splineSignals()
     QSignalSpy spy9(series, &QSplineSeries::hoverableChanged);
     QSignalSpy spy10(series, &QSplineSeries::opacityChanged);
     QSignalSpy spy11(series, &QSplineSeries::valuesMultiplierChanged);
+    QSignalSpy spy12(series, &QSplineSeries::decimationEnabledChanged);
 
     series->setWidth(10.0);
     series->setCapStyle(Qt::PenCapStyle::RoundCap);
+    series->setDecimationEnabled(true);
     series->setPointDelegate(marker);
 
     series->setColor("#0000ff");
@@ -158,6 +169,7 @@ void tst_splines::splineSignals()
     QCOMPARE(spy9.size(), 1);
     QCOMPARE(spy10.size(), 1);
     QCOMPARE(spy11.size(), 1);
+    QCOMPARE(spy12.size(), 1);
 
     delete series;
     delete marker;
@@ -177,5 +189,136 @@ void tst_splines::invalidProperties()
     QCOMPARE(m_series->valuesMultiplier(), 0.0);
 }
 
+void tst_splines::controlPoints()
+{
+    QVERIFY(m_series);
+
+    // Control points are only kept up to date after the component is complete
+    static_cast<QQmlParserStatus *>(m_series)->componentComplete();
+
+    for (int i = 0; i < 200; ++i)
+        m_series->append(i, qSin(i * 0.1) * 10);
+    m_series->append(QList<QPointF>({{200, 1}, {201, 2}, {202, 3}}));
+    m_series->replace(100, QPointF(100, 5));
+    m_series->removeMultiple(0, 10);
+    m_series->remove(0);
+
+    // Updated control points match the ones solved from scratch
+    QSplineSeries reference;
+    reference.append(m_series->points());
+    static_cast<QQmlParserStatus *>(&reference)->componentComplete();
+
+    const auto &actual = m_series->getControlPoints();
+    const auto &expected = reference.getControlPoints();
+    QCOMPARE(actual.size(), expected.size());
+    for (qsizetype i = 0; i < actual.size(); ++i) {
+        QVERIFY(qAbs(actual[i].x() - expected[i].x()) < 1e-9);
+        QVERIFY(qAbs(actual[i].y() - expected[i].y()) < 1e-9);
+    }
+}
+
+static QQuickShapePath *findShapePath(QQuickItem *item, qreal strokeWidth)
+{
+    if (auto shape = qobject_cast<QQuickShape *>(item)) {
+        const auto paths = shape->findChildren<QQuickShapePath *>();
+        for (QQuickShapePath *path : paths) {
+            if (path->strokeWidth() == strokeWidth)
+                return path;
+        }
+    }
+    const auto children = item->childItems();
+    for (QQuickItem *child : children) {
+        if (auto path = findShapePath(child, strokeWidth))
+            return path;
+    }
+    return nullptr;
+}
+
+void tst_splines::decimation()
+{
+    QQuickWindow window;
+    QValueAxis axisX;
+    QValueAxis axisY;
+    axisX.setMax(40);
+    axisY.setMin(-2);
+    axisY.setMax(2);
+
+    QList<QPointF> points;
+    for (int i = 0; i < 4000; ++i)
+        points << QPointF(i * 0.01, qSin(i * 1.3) + qSin(i * 0.05));
+
+    // The undecimated series is drawn through every mapped point, which gives the
+    // render coordinates the decimated one is checked against
+    QSplineSeries reference;
+    reference.setWidth(1);
+    reference.append(points);
+    static_cast<QQmlParserStatus *>(&reference)->componentComplete();
+    m_series->setWidth(3);
+    m_series->setDecimationEnabled(true);
+    m_series->append(points);
+    static_cast<QQmlParserStatus *>(m_series)->componentComplete();
+
+    QGraphsView view;
+    view.setParentItem(window.contentItem());
+    view.setSize(QSizeF(200, 200));
+    view.setAxisX(&axisX);
+    view.setAxisY(&axisY);
+    view.addSeries(&reference);
+    view.addSeries(m_series);
+
+    window.resize(200, 200);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+    QVERIFY(QQuickTest::qWaitForPolish(&view));
+
+    QQuickShapePath *referencePath = findShapePath(&view, 1);
+    QQuickShapePath *decimatedPath = findShapePath(&view, 3);
+    QVERIFY(referencePath);
+    QVERIFY(decimatedPath);
+
+    // A spline path is a move followed by a cubic per point, ending at the point
+    const QPainterPath referencePainterPath = referencePath->path();
+    QCOMPARE(referencePainterPath.elementCount(), 1 + 3 * (points.size() - 1));
+    QList<QPointF> mapped;
+    for (int i = 0; i < referencePainterPath.elementCount(); i += 3)
+        mapped << QPointF(referencePainterPath.elementAt(i));
+
+    const QPainterPath decimatedPainterPath = decimatedPath->path();
+    QList<QPointF> kept;
+    for (int i = 0; i < decimatedPainterPath.elementCount(); ++i)
+        kept << QPointF(decimatedPainterPath.elementAt(i));
+    QVERIFY(kept.size() < mapped.size());
+
+    // Each pixel column keeps at most its first, lowest, highest and last point
+    qsizetype k = 0;
+    qsizetype i = 0;
+    while (i < mapped.size()) {
+        const qreal column = std::floor(mapped[i].x());
+        const qsizetype start = i;
+        qreal minY = mapped[i].y();
+        qreal maxY = mapped[i].y();
+        while (++i < mapped.size() && std::floor(mapped[i].x()) == column) {
+            minY = qMin(minY, mapped[i].y());
+            maxY = qMax(maxY, mapped[i].y());
+        }
+
+        const qsizetype columnStart = k;
+        while (k < kept.size() && std::floor(kept[k].x()) == column)
+            ++k;
+        const QList<QPointF> columnPoints = kept.mid(columnStart, k - columnStart);
+        QVERIFY(!columnPoints.isEmpty());
+        QVERIFY(columnPoints.size() <= 4);
+        QCOMPARE(columnPoints.first(), mapped[start]);
+        QCOMPARE(columnPoints.last(), mapped[i - 1]);
+        const auto hasY = [&columnPoints](qreal y) {
+            return std::any_of(columnPoints.cbegin(), columnPoints.cend(),
+                               [y](const QPointF &point) { return point.y() == y; });
+        };
+        QVERIFY(hasY(minY));
+        QVERIFY(hasY(maxY));
+    }
+    QCOMPARE(k, kept.size());
+}
+
 #include "tst_splines.moc"
 QTEST_MAIN(tst_splines)
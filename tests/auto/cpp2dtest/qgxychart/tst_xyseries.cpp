@@ -22,6 +22,7 @@ private slots:
     void replaceAtClear();
     void find();
     void take();
+    void maxPoints();
 
 private:
     // QXYSeries is uncreatable, so testing is done through QScatterSeries
@@ -49,6 +50,7 @@ void tst_xyseries::initialProperties()
     // Properties from QXYSeries
     QCOMPARE(m_series->color(), QColor(Qt::transparent));
     QCOMPARE(m_series->selectedColor(), QColor(Qt::transparent));
+    QCOMPARE(m_series->maxPoints(), 0);
 }
 
 void tst_xyseries::initializeProperties()
@@ -226,5 +228,55 @@ void tst_xyseries::take()
     QCOMPARE(m_series->count(), 4);
 }
 
+void tst_xyseries::maxPoints()
+{
+    QVERIFY(m_series);
+    QSignalSpy maxPointsSpy(m_series, &QXYSeries::maxPointsChanged);
+    QSignalSpy countSpy(m_series, &QXYSeries::countChanged);
+    QSignalSpy pointsRemovedSpy(m_series, &QXYSeries::pointsRemoved);
+
+    m_series->append({{0, 0}, {1, 1}, {2, 2}, {3, 3}, {4, 4}});
+    QCOMPARE(countSpy.size(), 1);
+
+    // Reducing the limit drops the oldest points
+    m_series->setMaxPoints(3);
+    QCOMPARE(m_series->maxPoints(), 3);
+    QCOMPARE(maxPointsSpy.size(), 1);
+    QCOMPARE(m_series->points(), QList<QPointF>({{2, 2}, {3, 3}, {4, 4}}));
+    QCOMPARE(pointsRemovedSpy.size(), 1);
+
+    m_series->setMaxPoints(3);
+    QCOMPARE(maxPointsSpy.size(), 1);
+
+    // A full series keeps its size when appending
+    m_series->selectPoint(2);
+    countSpy.clear();
+    m_series->append(5, 5);
+    QCOMPARE(m_series->points(), QList<QPointF>({{3, 3}, {4, 4}, {5, 5}}));
+    QCOMPARE(countSpy.size(), 0);
+    QCOMPARE(pointsRemovedSpy.size(), 2);
+    QCOMPARE(pointsRemovedSpy.last().at(0).value<qsizetype>(), 0);
+    QCOMPARE(pointsRemovedSpy.last().at(1).value<qsizetype>(), 1);
+    QCOMPARE(m_series->selectedPoints(), QList<qsizetype>({1}));
+
+    m_series->append({{6, 6}, {7, 7}});
+    QCOMPARE(m_series->points(), QList<QPointF>({{5, 5}, {6, 6}, {7, 7}}));
+    QCOMPARE(m_series->selectedPoints(), QList<qsizetype>());
+
+    // Only the newest points are kept when appending more than fits
+    m_series->append({{8, 8}, {9, 9}, {10, 10}, {11, 11}});
+    QCOMPARE(m_series->points(), QList<QPointF>({{9, 9}, {10, 10}, {11, 11}}));
+    QCOMPARE(countSpy.size(), 0);
+
+    // Series that are not full grow normally
+    m_series->setMaxPoints(0);
+    m_series->append(12, 12);
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(countSpy.size(), 1);
+
+    m_series->setMaxPoints(-1);
+    QCOMPARE(m_series->maxPoints(), 0);
+}
+
 QTEST_MAIN(tst_xyseries)
 #include "tst_xyseries.moc"
@@ -45,6 +45,7 @@ private Q_SLOTS:
     void modelUpdateCell();
     void verticalMapperSignals();
     void horizontalMapperSignals();
+    void chunkedLoading();
 
 private:
     QStandardItemModel *m_model;
@@ -579,6 +580,43 @@ void tst_qgxymodelmapper::horizontalMapperSignals()
     delete mapper;
 }
 
+void tst_qgxymodelmapper::chunkedLoading()
+{
+    QXYModelMapper *mapper = new QXYModelMapper;
+    QSignalSpy chunkSizeSpy(mapper, &QXYModelMapper::chunkSizeChanged);
+    QSignalSpy progressSpy(mapper, &QXYModelMapper::loadingProgress);
+
+    mapper->setChunkSize(4);
+    QCOMPARE(mapper->chunkSize(), 4);
+    QCOMPARE(chunkSizeSpy.size(), 1);
+
+    mapper->setXSection(0);
+    mapper->setYSection(1);
+    mapper->setModel(m_model);
+    mapper->setSeries(m_series);
+
+    // The first chunk is added at once, the rest from the event loop
+    QCOMPARE(m_series->count(), 4);
+    QCOMPARE(progressSpy.size(), 1);
+    QCOMPARE(progressSpy.last().at(0).value<qsizetype>(), 4);
+    QCOMPARE(progressSpy.last().at(1).value<qsizetype>(), m_modelRowCount);
+
+    QTRY_COMPARE(m_series->count(), m_modelRowCount);
+    QCOMPARE(progressSpy.size(), 3);
+    QCOMPARE(progressSpy.last().at(0).value<qsizetype>(), m_modelRowCount);
+    QCOMPARE(progressSpy.last().at(1).value<qsizetype>(), m_modelRowCount);
+    for (int i = 0; i < m_modelRowCount; ++i)
+        QCOMPARE(m_series->points().at(i), QPointF(0, i));
+
+    // Inserting rows while loading starts over
+    mapper->setFirst(0);
+    QCOMPARE(m_series->count(), 4);
+    m_model->insertRows(0, 2);
+    QTRY_COMPARE(m_series->count(), m_modelRowCount + 2);
+
+    delete mapper;
+}
+
 QTEST_MAIN(tst_qgxymodelmapper)
 
 #include "tst_xymodelmapper.moc"
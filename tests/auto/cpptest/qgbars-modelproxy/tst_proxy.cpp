@@ -25,6 +25,8 @@ private slots:
     void initializeProperties();
 
     void multiMatch();
+    void roleMappedDataChanged();
+    void resolveInBackground();
 
 private:
     QItemModelBarDataProxy *m_proxy;
@@ -160,6 +162,7 @@ void tst_proxy::initialProperties()
     QCOMPARE(m_proxy->valueRole(), QString());
     QCOMPARE(m_proxy->valueRolePattern(), QRegularExpression());
     QCOMPARE(m_proxy->valueRoleReplace(), QString());
+    QCOMPARE(m_proxy->resolveInBackground(), false);
 
     QCOMPARE(m_proxy->series()->columnLabels().size(), 0);
     QCOMPARE(m_proxy->rowCount(), 0);
@@ -190,6 +193,8 @@ void tst_proxy::initializeProperties()
     QSignalSpy valueRoleReplacedSpy(m_proxy, &QItemModelBarDataProxy::valueRoleReplaceChanged);
     QSignalSpy rotationRoleReplacedSpy(m_proxy, &QItemModelBarDataProxy::rotationRoleReplaceChanged);
     QSignalSpy multiMatchSpy(m_proxy, &QItemModelBarDataProxy::multiMatchBehaviorChanged);
+    QSignalSpy resolveInBackgroundSpy(m_proxy,
+                                      &QItemModelBarDataProxy::resolveInBackgroundChanged);
 
     QTableWidget table;
 
@@ -212,6 +217,7 @@ void tst_proxy::initializeProperties()
     m_proxy->setValueRole("value");
     m_proxy->setValueRolePattern(QRegularExpression("/-/"));
     m_proxy->setValueRoleReplace("\\\\1");
+    m_proxy->setResolveInBackground(true);
 
     QCOMPARE(m_proxy->autoColumnCategories(), false);
     QCOMPARE(m_proxy->autoRowCategories(), false);
@@ -232,6 +238,7 @@ void tst_proxy::initializeProperties()
     QCOMPARE(m_proxy->valueRole(), QString("value"));
     QCOMPARE(m_proxy->valueRolePattern(), QRegularExpression("/-/"));
     QCOMPARE(m_proxy->valueRoleReplace(), QString("\\\\1"));
+    QCOMPARE(m_proxy->resolveInBackground(), true);
 
     QCOMPARE(itemModelSpy.size(), 1);
     QCOMPARE(rowRoleSpy.size(), 1);
@@ -250,6 +257,7 @@ void tst_proxy::initializeProperties()
     QCOMPARE(valueRoleReplacedSpy.size(), 1);
     QCOMPARE(rotationRoleReplacedSpy.size(), 1);
     QCOMPARE(multiMatchSpy.size(), 1);
+    QCOMPARE(resolveInBackgroundSpy.size(), 1);
 }
 
 void tst_proxy::multiMatch()
@@ -315,5 +323,104 @@ void tst_proxy::multiMatch()
     m_proxy = 0; // Proxy gets deleted as graph gets deleted
 }
 
+void tst_proxy::roleMappedDataChanged()
+{
+    QTableWidget table;
+    table.setRowCount(1);
+    table.setColumnCount(3);
+    const char *values[3] = {"0/0/3.5", "0/0/5.0", "1/0/6.5"};
+    for (int col = 0; col < 3; col++)
+        table.model()->setData(table.model()->index(0, col), values[col]);
+
+    m_proxy->setItemModel(table.model());
+    m_proxy->setRowRole(table.model()->roleNames().value(Qt::DisplayRole));
+    m_proxy->setColumnRole(table.model()->roleNames().value(Qt::DisplayRole));
+    m_proxy->setRowRolePattern(QRegularExpression(QStringLiteral("^(\\d*)\\/(\\d*)\\/.*$")));
+    m_proxy->setRowRoleReplace(QStringLiteral("\\2"));
+    m_proxy->setColumnRolePattern(QRegularExpression(QStringLiteral("^(\\d*)\\/(\\d*)\\/.*$")));
+    m_proxy->setColumnRoleReplace(QStringLiteral("\\1"));
+    m_proxy->setValueRolePattern(QRegularExpression(QStringLiteral("^\\d*\\/\\d*\\/(.*)$")));
+    m_proxy->setValueRoleReplace(QStringLiteral("\\1"));
+    m_proxy->setMultiMatchBehavior(QItemModelBarDataProxy::MultiMatchBehavior::Cumulative);
+    QCoreApplication::processEvents();
+
+    QCOMPARE(m_proxy->rowCount(), 1);
+    QCOMPARE(m_proxy->colCount(), 2);
+    QCOMPARE(m_proxy->itemAt(0, 0).value(), 8.5f);
+    QCOMPARE(m_proxy->itemAt(0, 1).value(), 6.5f);
+
+    // Changing a value within the same bar only updates that bar
+    QSignalSpy itemSpy(m_proxy, &QBarDataProxy::itemChanged);
+    QSignalSpy resetSpy(m_proxy, &QBarDataProxy::arrayReset);
+    table.model()->setData(table.model()->index(0, 1), "0/0/1.0");
+    QCOMPARE(itemSpy.size(), 1);
+    QCOMPARE(m_proxy->itemAt(0, 0).value(), 4.5f);
+    QCoreApplication::processEvents();
+    QCOMPARE(resetSpy.size(), 0);
+
+    m_proxy->setMultiMatchBehavior(QItemModelBarDataProxy::MultiMatchBehavior::Average);
+    QCoreApplication::processEvents();
+    QCOMPARE(m_proxy->itemAt(0, 0).value(), 2.25f);
+    resetSpy.clear();
+    table.model()->setData(table.model()->index(0, 0), "0/0/5.5");
+    QCOMPARE(m_proxy->itemAt(0, 0).value(), 3.25f);
+    QCoreApplication::processEvents();
+    QCOMPARE(resetSpy.size(), 0);
+
+    // Moving an item to another bar resolves the whole model again
+    table.model()->setData(table.model()->index(0, 0), "1/0/5.5");
+    QCoreApplication::processEvents();
+    QCOMPARE(resetSpy.size(), 1);
+    QCOMPARE(m_proxy->series()->columnLabels(), QStringList({"1", "0"}));
+    QCOMPARE(m_proxy->itemAt(0, 0).value(), 6.0f);
+    QCOMPARE(m_proxy->itemAt(0, 1).value(), 1.0f);
+}
+
+void tst_proxy::resolveInBackground()
+{
+    QTableWidget table;
+    table.setRowCount(1);
+    table.setColumnCount(3);
+    const char *values[3] = {"0/0/3.5", "0/0/5.0", "1/0/6.5"};
+    for (int col = 0; col < 3; col++)
+        table.model()->setData(table.model()->index(0, col), values[col]);
+
+    QSignalSpy resetSpy(m_proxy, &QBarDataProxy::arrayReset);
+    m_proxy->setResolveInBackground(true);
+    m_proxy->setRowRole(table.model()->roleNames().value(Qt::DisplayRole));
+    m_proxy->setColumnRole(table.model()->roleNames().value(Qt::DisplayRole));
+    m_proxy->setRowRolePattern(QRegularExpression(QStringLiteral("^(\\d*)\\/(\\d*)\\/.*$")));
+    m_proxy->setRowRoleReplace(QStringLiteral("\\2"));
+    m_proxy->setColumnRolePattern(QRegularExpression(QStringLiteral("^(\\d*)\\/(\\d*)\\/.*$")));
+    m_proxy->setColumnRoleReplace(QStringLiteral("\\1"));
+    m_proxy->setValueRolePattern(QRegularExpression(QStringLiteral("^\\d*\\/\\d*\\/(.*)$")));
+    m_proxy->setValueRoleReplace(QStringLiteral("\\1"));
+    m_proxy->setMultiMatchBehavior(QItemModelBarDataProxy::MultiMatchBehavior::Cumulative);
+    m_proxy->setItemModel(table.model());
+
+    QTRY_COMPARE(resetSpy.size(), 1);
+    QCOMPARE(m_proxy->rowCount(), 1);
+    QCOMPARE(m_proxy->colCount(), 2);
+    QCOMPARE(m_proxy->columnCategories(), QStringList({"0", "1"}));
+    QCOMPARE(m_proxy->itemAt(0, 0).value(), 8.5f);
+    QCOMPARE(m_proxy->itemAt(0, 1).value(), 6.5f);
+
+    // Changes made while resolving are not lost
+    table.setColumnCount(4);
+    table.model()->setData(table.model()->index(0, 3), "1/0/1.5");
+    QCoreApplication::processEvents();
+    table.model()->setData(table.model()->index(0, 0), "0/0/1.0");
+
+    QTRY_COMPARE(m_proxy->itemAt(0, 1).value(), 8.0f);
+    QTRY_COMPARE(m_proxy->itemAt(0, 0).value(), 6.0f);
+
+    // The bookkeeping of the background resolve is used for in place updates
+    resetSpy.clear();
+    table.model()->setData(table.model()->index(0, 1), "0/0/2.0");
+    QCOMPARE(m_proxy->itemAt(0, 0).value(), 3.0f);
+    QCoreApplication::processEvents();
+    QCOMPARE(resetSpy.size(), 0);
+}
+
 QTEST_MAIN(tst_proxy)
 #include "tst_proxy.moc"
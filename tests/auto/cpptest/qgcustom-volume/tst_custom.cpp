@@ -21,6 +21,8 @@ private slots:
     void initializeProperties();
     void invalidProperties();
 
+    void grayscaleTextureData();
+
 private:
     QCustom3DVolume *m_custom;
 };
@@ -104,6 +106,8 @@ void tst_custom::initialProperties()
     QCOMPARE(m_custom->sliceIndexY(), -1);
     QCOMPARE(m_custom->sliceIndexZ(), -1);
     QCOMPARE(m_custom->useHighDefShader(), true);
+    QCOMPARE(m_custom->windowLevel(), 0.5f);
+    QCOMPARE(m_custom->windowWidth(), 1.0f);
 
     // Common (from QCustom3DVolume)
     QCOMPARE(m_custom->meshFile(), QString(":/defaultMeshes/barMeshFull"));
@@ -132,6 +136,8 @@ void tst_custom::initializeProperties()
     QSignalSpy textureFormatSpy(m_custom, &QCustom3DVolume::textureFormatChanged);
     QSignalSpy alphaMultiplierSpy(m_custom, &QCustom3DVolume::alphaMultiplierChanged);
     QSignalSpy preserveOpacitySpy(m_custom, &QCustom3DVolume::preserveOpacityChanged);
+    QSignalSpy windowLevelSpy(m_custom, &QCustom3DVolume::windowLevelChanged);
+    QSignalSpy windowWidthSpy(m_custom, &QCustom3DVolume::windowWidthChanged);
     QSignalSpy useHighDefShaderSpy(m_custom, &QCustom3DVolume::useHighDefShaderChanged);
     QSignalSpy drawSlicesSpy(m_custom, &QCustom3DVolume::drawSlicesChanged);
     QSignalSpy drawSliceFramesSpy(m_custom, &QCustom3DVolume::drawSliceFramesChanged);
@@ -152,6 +158,8 @@ void tst_custom::initializeProperties()
     m_custom->setSliceIndexY(0);
     m_custom->setSliceIndexZ(0);
     m_custom->setUseHighDefShader(false);
+    m_custom->setWindowLevel(0.25f);
+    m_custom->setWindowWidth(0.1f);
 
     QCOMPARE(m_custom->alphaMultiplier(), 0.1f);
     QCOMPARE(m_custom->drawSliceFrames(), true);
@@ -165,7 +173,8 @@ void tst_custom::initializeProperties()
     QCOMPARE(m_custom->sliceIndexY(), 0);
     QCOMPARE(m_custom->sliceIndexZ(), 0);
     QCOMPARE(m_custom->useHighDefShader(), false);
-
+    QCOMPARE(m_custom->windowLevel(), 0.25f);
+    QCOMPARE(m_custom->windowWidth(), 0.1f);
 
     // Common (from QCustom3DVolume)
     m_custom->setPosition(QVector3D(1.0f, 1.0f, 1.0f));
@@ -202,6 +211,8 @@ void tst_custom::initializeProperties()
     QCOMPARE(textureFormatSpy.size(), 0);
     QCOMPARE(alphaMultiplierSpy.size(), 1);
     QCOMPARE(preserveOpacitySpy.size(), 1);
+    QCOMPARE(windowLevelSpy.size(), 1);
+    QCOMPARE(windowWidthSpy.size(), 1);
     QCOMPARE(useHighDefShaderSpy.size(), 1);
     QCOMPARE(drawSlicesSpy.size(), 1);
     QCOMPARE(drawSliceFramesSpy.size(), 1);
@@ -225,9 +236,38 @@ void tst_custom::invalidProperties()
     m_custom->setSliceFrameWidths(QVector3D(-0.1f, -0.1f, -0.1f));
     QCOMPARE(m_custom->sliceFrameWidths(), QVector3D(0.01f, 0.01f, 0.01f));
 
+    m_custom->setWindowWidth(0.0f);
+    QCOMPARE(m_custom->windowWidth(), 1.0f);
+
     m_custom->setTextureFormat(QImage::Format_ARGB8555_Premultiplied);
     QCOMPARE(m_custom->textureFormat(), QImage::Format_ARGB32);
 }
 
+void tst_custom::grayscaleTextureData()
+{
+    QImage image(3, 2, QImage::Format_Grayscale16);
+    for (int y = 0; y < image.height(); y++) {
+        quint16 *line = reinterpret_cast<quint16 *>(image.scanLine(y));
+        for (int x = 0; x < image.width(); x++)
+            line[x] = quint16(y * 1000 + x);
+    }
+    QList<QImage *> images = { &image, &image };
+
+    m_custom->createTextureData(images);
+    QCOMPARE(m_custom->textureFormat(), QImage::Format_Grayscale16);
+    QCOMPARE(m_custom->textureWidth(), 3);
+    QCOMPARE(m_custom->textureHeight(), 2);
+    QCOMPARE(m_custom->textureDepth(), 2);
+    // Lines of 16-bit texels are padded to a 32-bit boundary
+    QCOMPARE(m_custom->textureDataWidth(), 8);
+    QCOMPARE(m_custom->textureData()->size(), 8 * 2 * 2);
+
+    QImage slice = m_custom->renderSlice(Qt::ZAxis, 1);
+    QCOMPARE(slice.format(), QImage::Format_Grayscale16);
+    QCOMPARE(slice.size(), image.size());
+    const quint16 *sliceLine = reinterpret_cast<const quint16 *>(slice.constScanLine(1));
+    QCOMPARE(sliceLine[2], quint16(1002));
+}
+
 QTEST_MAIN(tst_custom)
 #include "tst_custom.moc"
@@ -23,6 +23,8 @@ private slots:
     void initializeProperties();
 
     void addModel();
+    void rolePatternAlternation();
+    void resolveInBackground();
 
 private:
     QItemModelScatterDataProxy *m_proxy;
@@ -108,6 +110,7 @@ void tst_proxy::initialProperties()
     QCOMPARE(m_proxy->zPosRole(), QString());
     QCOMPARE(m_proxy->zPosRolePattern(), QRegularExpression());
     QCOMPARE(m_proxy->zPosRoleReplace(), QString());
+    QCOMPARE(m_proxy->resolveInBackground(), false);
 
     QCOMPARE(m_proxy->itemCount(), 0);
 
@@ -132,6 +135,8 @@ void tst_proxy::initializeProperties()
     QSignalSpy yPosRoleReplaceSpy(m_proxy, &QItemModelScatterDataProxy::yPosRoleReplaceChanged);
     QSignalSpy zPosRoleReplaceSpy(m_proxy, &QItemModelScatterDataProxy::zPosRoleReplaceChanged);
     QSignalSpy rotationRoleReplaceSpy(m_proxy, &QItemModelScatterDataProxy::rotationRoleReplaceChanged);
+    QSignalSpy resolveInBackgroundSpy(m_proxy,
+                                      &QItemModelScatterDataProxy::resolveInBackgroundChanged);
 
     QTableWidget table;
 
@@ -148,6 +153,7 @@ void tst_proxy::initializeProperties()
     m_proxy->setZPosRole("Z");
     m_proxy->setZPosRolePattern(QRegularExpression("/-/"));
     m_proxy->setZPosRoleReplace("\\\\1");
+    m_proxy->setResolveInBackground(true);
 
     QVERIFY(m_proxy->itemModel());
     QCOMPARE(m_proxy->rotationRole(), QString("rotation"));
@@ -162,6 +168,7 @@ void tst_proxy::initializeProperties()
     QCOMPARE(m_proxy->zPosRole(), QString("Z"));
     QCOMPARE(m_proxy->zPosRolePattern(), QRegularExpression("/-/"));
     QCOMPARE(m_proxy->zPosRoleReplace(), QString("\\\\1"));
+    QCOMPARE(m_proxy->resolveInBackground(), true);
 
     QCOMPARE(itemModelSpy.size(), 1);
     QCOMPARE(xPosRoleSpy.size(), 1);
@@ -176,6 +183,7 @@ void tst_proxy::initializeProperties()
     QCOMPARE(yPosRoleReplaceSpy.size(), 1);
     QCOMPARE(zPosRoleReplaceSpy.size(), 1);
     QCOMPARE(rotationRoleReplaceSpy.size(), 1);
+    QCOMPARE(resolveInBackgroundSpy.size(), 1);
 }
 
 void tst_proxy::addModel()
@@ -218,5 +226,55 @@ void tst_proxy::addModel()
     m_proxy = 0; // proxy gets deleted with series
 }
 
+void tst_proxy::rolePatternAlternation()
+{
+    QTableWidget table;
+    table.setRowCount(1);
+    table.setColumnCount(1);
+    table.model()->setData(table.model()->index(0, 0), QStringLiteral("3.5"));
+
+    m_proxy->setItemModel(table.model());
+    m_proxy->setXPosRole(table.model()->roleNames().value(Qt::DisplayRole));
+    // The alternative matches only the last digit, so the replace keeps the rest of the value
+    m_proxy->setXPosRolePattern(QRegularExpression(QStringLiteral("^x|(\\d)$")));
+    m_proxy->setXPosRoleReplace(QStringLiteral("\\1"));
+    QCoreApplication::processEvents();
+
+    QCOMPARE(m_proxy->itemCount(), 1);
+    QCOMPARE(m_proxy->itemAt(0).x(), 3.5f);
+
+    delete m_series;
+    m_proxy = 0; // proxy gets deleted with series
+}
+
+void tst_proxy::resolveInBackground()
+{
+    QTableWidget table;
+    table.setRowCount(2);
+    table.setColumnCount(3);
+    for (int row = 0; row < 2; row++) {
+        for (int col = 0; col < 3; col++)
+            table.model()->setData(table.model()->index(row, col), row * 10 + col);
+    }
+
+    QSignalSpy resetSpy(m_proxy, &QScatterDataProxy::arrayReset);
+    m_proxy->setResolveInBackground(true);
+    m_proxy->setYPosRole(table.model()->roleNames().value(Qt::DisplayRole));
+    m_proxy->setItemModel(table.model());
+
+    QTRY_COMPARE(resetSpy.size(), 1);
+    QCOMPARE(m_proxy->itemCount(), 6);
+    QCOMPARE(m_proxy->itemAt(5).y(), 12.0f);
+
+    // Changes made while resolving are not lost
+    table.setRowCount(3);
+    table.model()->setData(table.model()->index(2, 0), 20);
+    QCoreApplication::processEvents();
+    table.model()->setData(table.model()->index(2, 1), 21);
+
+    QTRY_COMPARE(m_proxy->itemCount(), 9);
+    QTRY_COMPARE(m_proxy->itemAt(7).y(), 21.0f);
+}
+
 QTEST_MAIN(tst_proxy)
 #include "tst_proxy.moc"
@@ -3,6 +3,7 @@
 
 #include <QtTest/QtTest>
 
+#include <QtGraphs/private/qquickgraphsitem_p.h>
 #include <QtGraphsWidgets/q3dscatterwidgetitem.h>
 
 #include "cpptestutil.h"
@@ -29,6 +30,7 @@ private slots:
     void removeSeries();
     void removeMultipleSeries();
     void hasSeries();
+    void addItemSynchUpdates();
 
 private:
     Q3DScatterWidgetItem *m_graph;
@@ -241,5 +243,39 @@ void tst_scatter::hasSeries()
     QCOMPARE(m_graph->hasSeries(series2), false);
 }
 
+void tst_scatter::addItemSynchUpdates()
+{
+    // Fixed ranges, so that the added item cannot change the axes
+    m_graph->axisX()->setRange(-1.0f, 1.0f);
+    m_graph->axisY()->setRange(-1.0f, 1.0f);
+    m_graph->axisZ()->setRange(-1.0f, 1.0f);
+    QScatter3DSeries *series = newSeries();
+    m_graph->addSeries(series);
+
+    m_quickWidget->resize(200, 200);
+    m_quickWidget->show();
+    QVERIFY(QTest::qWaitForWindowExposed(m_quickWidget));
+    auto graphsItem = qobject_cast<QQuickGraphsItem *>(m_quickWidget->rootObject());
+    QVERIFY(graphsItem);
+
+    // Wait for a frame that no longer lays out the grid, the labels or the custom items
+    QTRY_VERIFY([graphsItem]() {
+        const QQuickGraphsItem::SynchUpdateCounts counts = graphsItem->synchUpdateCounts();
+        graphsItem->resetSynchUpdateCounts();
+        graphsItem->update();
+        return counts.synchs > 0 && !counts.grid && !counts.labels && !counts.customVolumes;
+    }());
+
+    graphsItem->resetSynchUpdateCounts();
+    const QScatterDataItem item(0.1f, 0.2f, 0.3f);
+    series->dataProxy()->addItem(item);
+    QTRY_VERIFY(graphsItem->synchUpdateCounts().graph > 0);
+
+    const QQuickGraphsItem::SynchUpdateCounts counts = graphsItem->synchUpdateCounts();
+    QCOMPARE(counts.grid, 0);
+    QCOMPARE(counts.labels, 0);
+    QCOMPARE(counts.customVolumes, 0);
+}
+
 QTEST_MAIN(tst_scatter)
 #include "tst_scatter.moc"
@@ -25,6 +25,7 @@ private slots:
     void initializeProperties();
 
     void multiMatch();
+    void resolveInBackground();
 
 private:
     QItemModelSurfaceDataProxy *m_proxy;
@@ -161,6 +162,7 @@ void tst_proxy::initialProperties()
     QCOMPARE(m_proxy->rowRolePattern(), QRegularExpression());
     QCOMPARE(m_proxy->rowRoleReplace(), QString());
     QCOMPARE(m_proxy->useModelCategories(), false);
+    QCOMPARE(m_proxy->resolveInBackground(), false);
     QCOMPARE(m_proxy->xPosRole(), QString());
     QCOMPARE(m_proxy->xPosRolePattern(), QRegularExpression());
     QCOMPARE(m_proxy->xPosRoleReplace(), QString());
@@ -204,6 +206,8 @@ void tst_proxy::initializeProperties()
     QSignalSpy yPosRoleReplaceSpy(m_proxy, &QItemModelSurfaceDataProxy::yPosRoleReplaceChanged);
     QSignalSpy zPosRoleReplaceSpy(m_proxy, &QItemModelSurfaceDataProxy::zPosRoleReplaceChanged);
     QSignalSpy multiMatchSpy(m_proxy, &QItemModelSurfaceDataProxy::multiMatchBehaviorChanged);
+    QSignalSpy resolveInBackgroundSpy(m_proxy,
+                                      &QItemModelSurfaceDataProxy::resolveInBackgroundChanged);
 
     QTableWidget table;
 
@@ -220,6 +224,7 @@ void tst_proxy::initializeProperties()
     m_proxy->setRowRolePattern(QRegularExpression("/^(\\d\\d\\d\\d).*$/"));
     m_proxy->setRowRoleReplace("\\\\1");
     m_proxy->setUseModelCategories(true);
+    m_proxy->setResolveInBackground(true);
     m_proxy->setXPosRole("X");
     m_proxy->setXPosRolePattern(QRegularExpression("/-/"));
     m_proxy->setXPosRoleReplace("\\\\1");
@@ -243,6 +248,7 @@ void tst_proxy::initializeProperties()
     QCOMPARE(m_proxy->rowRolePattern(), QRegularExpression("/^(\\d\\d\\d\\d).*$/"));
     QCOMPARE(m_proxy->rowRoleReplace(), QString("\\\\1"));
     QCOMPARE(m_proxy->useModelCategories(), true);
+    QCOMPARE(m_proxy->resolveInBackground(), true);
     QCOMPARE(m_proxy->xPosRole(), QString("X"));
     QCOMPARE(m_proxy->xPosRolePattern(), QRegularExpression("/-/"));
     QCOMPARE(m_proxy->xPosRoleReplace(), QString("\\\\1"));
@@ -275,6 +281,7 @@ void tst_proxy::initializeProperties()
     QCOMPARE(yPosRoleReplaceSpy.size(), 1);
     QCOMPARE(zPosRoleReplaceSpy.size(), 1);
     QCOMPARE(multiMatchSpy.size(), 1);
+    QCOMPARE(resolveInBackgroundSpy.size(), 1);
 }
 
 void tst_proxy::multiMatch()
@@ -340,5 +347,35 @@ void tst_proxy::multiMatch()
     m_proxy = 0; // Graph deletes proxy
 }
 
+void tst_proxy::resolveInBackground()
+{
+    QTableWidget table;
+    table.setRowCount(2);
+    table.setColumnCount(3);
+    for (int row = 0; row < 2; row++) {
+        for (int col = 0; col < 3; col++)
+            table.model()->setData(table.model()->index(row, col), row * 10 + col);
+    }
+
+    QSignalSpy resetSpy(m_proxy, &QSurfaceDataProxy::arrayReset);
+    m_proxy->setResolveInBackground(true);
+    m_proxy->setUseModelCategories(true);
+    m_proxy->setItemModel(table.model());
+
+    QTRY_COMPARE(resetSpy.size(), 1);
+    QCOMPARE(m_proxy->rowCount(), 2);
+    QCOMPARE(m_proxy->columnCount(), 3);
+    QCOMPARE(m_proxy->itemAt(1, 2).y(), 12.0f);
+
+    // Changes made while resolving are not lost
+    table.setRowCount(3);
+    table.model()->setData(table.model()->index(2, 0), 20);
+    QCoreApplication::processEvents();
+    table.model()->setData(table.model()->index(2, 1), 21);
+
+    QTRY_COMPARE(m_proxy->rowCount(), 3);
+    QTRY_COMPARE(m_proxy->itemAt(2, 1).y(), 21.0f);
+}
+
 QTEST_MAIN(tst_proxy)
 #include "tst_proxy.moc"